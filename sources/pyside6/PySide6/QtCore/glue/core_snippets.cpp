@@ -52,6 +52,9 @@
 #include <QtCore/QStack>
 #include <QtCore/QVariant>
 
+#include <cstring>
+#include <limits>
+
 // Helpers for QVariant conversion
 
 QMetaType QVariant_resolveMetaType(PyTypeObject *type)
@@ -118,28 +121,160 @@ QVariant QVariant_convertToValueList(PyObject *list)
     return var;
 }
 
-bool QVariant_isStringList(PyObject *list)
+// Classify the items of a PySequence_Fast() in one pass to determine the
+// conversion.
+QVariantSequenceType QVariant_classifySequence(PyObject *fastSequence)
 {
-    if (!PySequence_Check(list)) {
-        // If it is not a list or a derived list class
-        // we assume that will not be a String list neither.
-        return false;
+    bool strings = true;
+    bool doubles = true;
+    bool ints = true;
+    bool basic = true;
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(fastSequence);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *item = PySequence_Fast_GET_ITEM(fastSequence, i);
+        if (PyUnicode_Check(item) != 0) {
+            basic &= PyUnicode_CheckExact(item) != 0;
+            doubles = ints = false;
+            continue;
+        }
+        strings = false;
+        if (PyFloat_CheckExact(item)) {
+            ints = false;
+        } else if (PyLong_CheckExact(item)) {
+            doubles = false;
+            if (ints) {
+                int overflow = 0;
+                const long value = PyLong_AsLongAndOverflow(item, &overflow);
+                ints = overflow == 0 && value >= std::numeric_limits<int>::min()
+                    && value <= std::numeric_limits<int>::max();
+            }
+        } else if (PyBool_Check(item)) {
+            doubles = ints = false;
+        } else {
+            return QVariantSequenceType::Other;
+        }
     }
+    if (strings)
+        return QVariantSequenceType::Strings;
+    if (doubles)
+        return QVariantSequenceType::Doubles;
+    if (ints)
+        return QVariantSequenceType::Ints;
+    return basic ? QVariantSequenceType::Basic : QVariantSequenceType::Other;
+}
 
-    if (PySequence_Size(list) < 0) {
-        // clear the error if < 0 which means no length at all
+template <class Item, class T>
+static QList<Item> bufferToList(const char *data, Py_ssize_t size, Py_ssize_t stride)
+{
+    QList<Item> result;
+    result.reserve(size);
+    for (Py_ssize_t i = 0; i < size; ++i, data += stride) {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        result.append(Item(value));
+    }
+    return result;
+}
+
+// Returns the kind ('i', 'u', 'f') of a struct module format of a native
+// number, or 0.
+static char bufferNumberKind(const char *format)
+{
+    if (format == nullptr)
+        return 'u';
+    switch (*format) {
+    case '@':
+    case '=':
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    case '<':
+#else
+    case '>':
+    case '!':
+#endif
+        ++format;
+        break;
+    default:
+        break;
+    }
+    if (format[0] == '\0' || format[1] != '\0')
+        return 0;
+    switch (format[0]) {
+    case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+        return 'i';
+    case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+        return 'u';
+    case 'f': case 'd':
+        return 'f';
+    default:
+        break;
+    }
+    return 0;
+}
+
+// Convert a 1-dimensional buffer of numbers (array.array, numpy arrays) to a
+// QList<double> or a QList<int> (integers of up to 32 bit) in one pass.
+// Returns an invalid QVariant for other objects.
+QVariant QVariant_convertBufferToList(PyObject *obj)
+{
+    if (PyObject_CheckBuffer(obj) == 0 || PyBytes_Check(obj) || PyByteArray_Check(obj))
+        return {};
+    Py_buffer view;
+    if (PyObject_GetBuffer(obj, &view, PyBUF_FORMAT | PyBUF_STRIDES) != 0) {
         PyErr_Clear();
-        return false;
+        return {};
     }
 
-    Shiboken::AutoDecRef fast(PySequence_Fast(list, "Failed to convert QVariantList"));
-    const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast.object());
-    for (Py_ssize_t i = 0; i < size; ++i) {
-        PyObject *item = PySequence_Fast_GET_ITEM(fast.object(), i);
-        if (PyUnicode_Check(item) == 0)
-            return false;
+    QVariant result;
+    if (view.ndim == 1) {
+        const auto *data = static_cast<const char *>(view.buf);
+        const Py_ssize_t size = view.shape != nullptr ? view.shape[0] : view.len / view.itemsize;
+        const Py_ssize_t stride = view.strides != nullptr ? view.strides[0] : view.itemsize;
+        switch (bufferNumberKind(view.format)) {
+        case 'i':
+            if (view.itemsize == 1)
+                result = QVariant::fromValue(bufferToList<int, qint8>(data, size, stride));
+            else if (view.itemsize == 2)
+                result = QVariant::fromValue(bufferToList<int, qint16>(data, size, stride));
+            else if (view.itemsize == 4)
+                result = QVariant::fromValue(bufferToList<int, qint32>(data, size, stride));
+            break;
+        case 'u':
+            if (view.itemsize == 1)
+                result = QVariant::fromValue(bufferToList<int, quint8>(data, size, stride));
+            else if (view.itemsize == 2)
+                result = QVariant::fromValue(bufferToList<int, quint16>(data, size, stride));
+            break;
+        case 'f':
+            if (view.itemsize == sizeof(float))
+                result = QVariant::fromValue(bufferToList<double, float>(data, size, stride));
+            else if (view.itemsize == sizeof(double))
+                result = QVariant::fromValue(bufferToList<double, double>(data, size, stride));
+            break;
+        }
     }
-    return true;
+    PyBuffer_Release(&view);
+    return result;
+}
+
+template <class Item, class Factory>
+static PyObject *numberListToPython(const QList<Item> &list, Factory factory)
+{
+    PyObject *result = PyList_New(list.size());
+    for (qsizetype i = 0, size = list.size(); i < size; ++i)
+        PyList_SET_ITEM(result, i, factory(list.at(i)));
+    return result;
+}
+
+// Convert the typed lists created for Python lists and buffers back to
+// Python lists. Returns nullptr for other variants.
+PyObject *QVariant_convertNumberListToPython(const QVariant &var)
+{
+    const QMetaType metaType = var.metaType();
+    if (metaType == QMetaType::fromType<QList<double>>())
+        return numberListToPython(var.value<QList<double>>(), PyFloat_FromDouble);
+    if (metaType == QMetaType::fromType<QList<int>>())
+        return numberListToPython(var.value<QList<int>>(), PyLong_FromLong);
+    return nullptr;
 }
 
 // Helpers for qAddPostRoutine
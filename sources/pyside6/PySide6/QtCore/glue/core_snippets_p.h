@@ -59,7 +59,21 @@ QMetaType QVariant_resolveMetaType(PyTypeObject *type);
 
 QVariant QVariant_convertToValueList(PyObject *list);
 
-bool QVariant_isStringList(PyObject *list);
+// Element types of a sequence relevant for QVariant conversion
+enum class QVariantSequenceType
+{
+    Strings,  // All str (also for empty sequences), converted to QStringList
+    Doubles,  // All float, converted to QList<double>
+    Ints,     // All int fitting into int, converted to QList<int>
+    Basic,    // float, int, bool and str only, converted directly
+    Other
+};
+
+QVariantSequenceType QVariant_classifySequence(PyObject *fastSequence);
+
+QVariant QVariant_convertBufferToList(PyObject *obj);
+
+PyObject *QVariant_convertNumberListToPython(const QVariant &var);
 
 // Helpers for qAddPostRoutine
 namespace PySide {
@@ -138,7 +138,7 @@ bool quickRegisterType(PyObject *pyObj, const char *uri, int versionMajor, int v
         return false;
 
     // Used inside macros to register the type.
-    const QMetaObject *metaObject = PySide::retrieveMetaObject(pyObj);
+    const QMetaObject *metaObject = PySide::retainMetaObject(pyObjType);
     Q_ASSERT(metaObject);
 
 
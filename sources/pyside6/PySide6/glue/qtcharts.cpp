@@ -42,11 +42,40 @@ Shiboken::Object::releaseOwnership(%PYARG_1);
 // @snippet qchart-releaseownership
 
 // @snippet qxyseries-appendnp-numpy-x-y
-const auto points = PySide::Numpy::xyDataToQPointFList(%PYARG_1, %PYARG_2);
-%CPPSELF.append(points);
+// append() copies the points, so the list is reused between calls. It is taken
+// out of the cache during the call since a slot connected to a signal emitted
+// by append() may call appendNp() again.
+static QList<QPointF> appendNpPoints;
+QList<QPointF> points;
+points.swap(appendNpPoints);
+if (PySide::Numpy::xyDataToQPointFList(%PYARG_1, %PYARG_2, &points)) {
+    %CPPSELF.append(points);
+} else {
+    PyErr_SetString(PyExc_TypeError,
+                    "appendNp(): x and y must be one-dimensional arrays of a numeric type in native byte order.");
+}
+if (points.isDetached())
+    appendNpPoints.swap(points);
 // @snippet qxyseries-appendnp-numpy-x-y
 
 // @snippet qxyseries-replacenp-numpy-x-y
-const auto points = PySide::Numpy::xyDataToQPointFList(%PYARG_1, %PYARG_2);
-%CPPSELF.replace(points);
+// replace() shares the list with the series. The list passed last is reused
+// once the series has released it by the next replace(), so that two lists
+// alternate.
+static QList<QPointF> replaceNpPoints;
+static QList<QPointF> replaceNpSparePoints;
+QList<QPointF> points;
+points.swap(replaceNpSparePoints);
+if (PySide::Numpy::xyDataToQPointFList(%PYARG_1, %PYARG_2, &points)) {
+    %CPPSELF.replace(points);
+    QList<QPointF> previous = replaceNpPoints;
+    replaceNpPoints = points;
+    if (previous.isDetached())
+        replaceNpSparePoints.swap(previous);
+} else {
+    PyErr_SetString(PyExc_TypeError,
+                    "replaceNp(): x and y must be one-dimensional arrays of a numeric type in native byte order.");
+    if (points.isDetached())
+        replaceNpSparePoints.swap(points);
+}
 // @snippet qxyseries-replacenp-numpy-x-y
@@ -43,10 +43,21 @@
 
 // @snippet include-pyside
 #include <pysideinit.h>
+#include <pysideutils.h>
 #include <limits>
 #include "glue/core_snippets_p.h"
 // @snippet include-pyside
 
+// @snippet qsettings-setvalue
+// Numeric buffers (array.array, numpy arrays) are stored as lists of numbers,
+// which Qt can save natively, rather than as pickled Python objects.
+QVariant bufferList = QVariant_convertBufferToList(%PYARG_2);
+const QVariant &value = bufferList.isValid() ? bufferList : %2;
+Py_BEGIN_ALLOW_THREADS
+%CPPSELF.%FUNCTION_NAME(%1, value);
+Py_END_ALLOW_THREADS
+// @snippet qsettings-setvalue
+
 // @snippet qsettings-value
 // If we enter the kwds, means that we have a defaultValue or
 // at least a type.
@@ -149,46 +160,100 @@ return %out;
 // @snippet conversion-qmetatype-pytypeobject
 
 // @snippet qvariant-conversion
+// Convert items of the basic types directly instead of dispatching through
+// the QVariant converter.
+static QVariant QVariant_convertItem(PyObject *item)
+{
+    if (PyFloat_CheckExact(item))
+        return QVariant(PyFloat_AsDouble(item));
+    if (PyLong_CheckExact(item)) {
+        int overflow = 0;
+        const long long value = PyLong_AsLongLongAndOverflow(item, &overflow);
+        if (overflow == 0) {
+            // PYSIDE-1250: For QVariant, if the type fits into an int; use int preferably.
+            if (value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max())
+                return QVariant(int(value));
+            return QVariant(qlonglong(value));
+        }
+    }
+    if (item == Py_True || item == Py_False)
+        return QVariant(item == Py_True);
+    if (PyUnicode_CheckExact(item)) {
+        QString str = %CONVERTTOCPP[QString](item);
+        return QVariant(str);
+    }
+    QVariant result = %CONVERTTOCPP[QVariant](item);
+    return result;
+}
+
 static QVariant QVariant_convertToVariantMap(PyObject *map)
 {
     Py_ssize_t pos = 0;
-    Shiboken::AutoDecRef keys(PyDict_Keys(map));
-    if (!QVariant_isStringList(keys))
-        return QVariant();
     PyObject *key;
     PyObject *value;
     QMap<QString,QVariant> ret;
     while (PyDict_Next(map, &pos, &key, &value)) {
+        if (PyUnicode_Check(key) == 0)
+            return QVariant();
         QString cppKey = %CONVERTTOCPP[QString](key);
-        QVariant cppValue = %CONVERTTOCPP[QVariant](value);
-        ret.insert(cppKey, cppValue);
+        ret.insert(cppKey, QVariant_convertItem(value));
     }
     return QVariant(ret);
 }
+
 static QVariant QVariant_convertToVariantList(PyObject *list)
 {
-    if (QVariant_isStringList(list)) {
-        QList<QString > lst = %CONVERTTOCPP[QList<QString>](list);
-        return QVariant(QStringList(lst));
-    }
-    QVariant valueList = QVariant_convertToValueList(list);
-    if (valueList.isValid())
-        return valueList;
+    // Numeric buffers (array.array, numpy arrays) are converted in one pass.
+    QVariant bufferList = QVariant_convertBufferToList(list);
+    if (bufferList.isValid())
+        return bufferList;
 
-    if (PySequence_Size(list) < 0) {
-        // clear the error if < 0 which means no length at all
+    Shiboken::AutoDecRef fast(PySequence_Fast(list, "Failed to convert QVariantList"));
+    if (fast.isNull()) {
         PyErr_Clear();
         return QVariant();
     }
-
-    QList<QVariant> lst;
-    Shiboken::AutoDecRef fast(PySequence_Fast(list, "Failed to convert QVariantList"));
     const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast.object());
-    for (Py_ssize_t i = 0; i < size; ++i) {
-        PyObject *pyItem = PySequence_Fast_GET_ITEM(fast.object(), i);
-        QVariant item = %CONVERTTOCPP[QVariant](pyItem);
-        lst.append(item);
+
+    switch (QVariant_classifySequence(fast.object())) {
+    case QVariantSequenceType::Strings: {
+        QStringList lst;
+        lst.reserve(size);
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            PyObject *pyItem = PySequence_Fast_GET_ITEM(fast.object(), i);
+            QString item = %CONVERTTOCPP[QString](pyItem);
+            lst.append(item);
+        }
+        return QVariant(lst);
+    }
+    case QVariantSequenceType::Doubles: {
+        QList<double> lst;
+        lst.reserve(size);
+        for (Py_ssize_t i = 0; i < size; ++i)
+            lst.append(PyFloat_AsDouble(PySequence_Fast_GET_ITEM(fast.object(), i)));
+        return QVariant::fromValue(lst);
+    }
+    case QVariantSequenceType::Ints: {
+        QList<int> lst;
+        lst.reserve(size);
+        for (Py_ssize_t i = 0; i < size; ++i)
+            lst.append(int(PyLong_AsLong(PySequence_Fast_GET_ITEM(fast.object(), i))));
+        return QVariant::fromValue(lst);
+    }
+    case QVariantSequenceType::Basic:
+        break;
+    case QVariantSequenceType::Other: {
+        QVariant valueList = QVariant_convertToValueList(list);
+        if (valueList.isValid())
+            return valueList;
+        break;
+    }
     }
+
+    QList<QVariant> lst;
+    lst.reserve(size);
+    for (Py_ssize_t i = 0; i < size; ++i)
+        lst.append(QVariant_convertItem(PySequence_Fast_GET_ITEM(fast.object(), i)));
     return QVariant(lst);
 }
 // @snippet qvariant-conversion
@@ -215,6 +280,24 @@ PyModule_AddObject(module, "__version_info__", pyQtVersion);
 PyModule_AddStringConstant(module, "__version__", qVersion());
 // @snippet qt-version
 
+// @snippet qlist-opaque-container-buffer-format
+// Expose the storage of QPointList and QPointFList to the buffer protocol
+// as 2-dimensional arrays of coordinates.
+template <>
+struct ShibokenContainerValueBufferFormat<QPoint>
+{
+    static constexpr const char *format = Shiboken::arithmeticBufferFormat<int>();
+    static constexpr Py_ssize_t componentCount = 2;
+};
+
+template <>
+struct ShibokenContainerValueBufferFormat<QPointF>
+{
+    static constexpr const char *format = Shiboken::arithmeticBufferFormat<qreal>();
+    static constexpr Py_ssize_t componentCount = 2;
+};
+// @snippet qlist-opaque-container-buffer-format
+
 // @snippet qobject-connect
 #include <qobjectconnect.h>
 // @snippet qobject-connect
@@ -491,8 +574,17 @@ qRegisterMetaType<QList<int> >("QList<int>");
 // @snippet qobject-metaobject
 %RETURN_TYPE %0 = %CPPSELF.%FUNCTION_NAME();
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
+PySide::keepMetaObjectAlive(%PYARG_0, %0);
 // @snippet qobject-metaobject
 
+// @snippet qmetaobject-keep-alive
+PySide::keepMetaObjectAlive(%PYARG_0, %CPPSELF);
+// @snippet qmetaobject-keep-alive
+
+// @snippet qmetaobject-superclass-keep-alive
+PySide::keepMetaObjectAlive(%PYARG_0, %CPPSELF->superClass());
+// @snippet qmetaobject-superclass-keep-alive
+
 // @snippet qobject-findchild-2
 QObject *child = qObjectFindChild(%CPPSELF, %2, reinterpret_cast<PyTypeObject *>(%PYARG_1), %3);
 %PYARG_0 = %CONVERTTOPYTHON[QObject *](child);
@@ -512,15 +604,6 @@ const QString result = qObjectTr(reinterpret_cast<PyTypeObject *>(%PYSELF), %1,
 %PYARG_0 = %CONVERTTOPYTHON[QString](result);
 // @snippet qobject-tr
 
-// @snippet qobject-receivers
-// Avoid return +1 because SignalManager connect to "destroyed()" signal to control object timelife
-int ret = %CPPSELF.%FUNCTION_NAME(%1);
-if (ret > 0 && ((strcmp(%1, SIGNAL(destroyed())) == 0) || (strcmp(%1, SIGNAL(destroyed(QObject*))) == 0)))
-    ret -= PySide::SignalManager::instance().countConnectionsWith(%CPPSELF);
-
-%PYARG_0 = %CONVERTTOPYTHON[int](ret);
-// @snippet qobject-receivers
-
 // @snippet qbytearray-mgetitem
 if (PyIndex_Check(_key)) {
     Py_ssize_t _i;
@@ -711,22 +794,32 @@ static PyBufferProcs SbkQByteArrayBufferProc = {
 // @snippet qbytearray-bufferprotocol
 
 // @snippet qbytearray-operatorplus-1
-QByteArray ba = QByteArray(PyBytes_AS_STRING(%PYARG_1), PyBytes_GET_SIZE(%PYARG_1)) + *%CPPSELF;
+// Concatenate into the result directly instead of copying the bytes into
+// a temporary QByteArray first.
+QByteArray ba;
+ba.reserve(PyBytes_GET_SIZE(%PYARG_1) + %CPPSELF.size());
+ba.append(PyBytes_AS_STRING(%PYARG_1), PyBytes_GET_SIZE(%PYARG_1));
+ba.append(*%CPPSELF);
 %PYARG_0 = %CONVERTTOPYTHON[QByteArray](ba);
 // @snippet qbytearray-operatorplus-1
 
 // @snippet qbytearray-operatorplus-2
-QByteArray ba = QByteArray(PyByteArray_AsString(%PYARG_1), PyByteArray_Size(%PYARG_1)) + *%CPPSELF;
+QByteArray ba;
+ba.reserve(PyByteArray_Size(%PYARG_1) + %CPPSELF.size());
+ba.append(PyByteArray_AsString(%PYARG_1), PyByteArray_Size(%PYARG_1));
+ba.append(*%CPPSELF);
 %PYARG_0 = %CONVERTTOPYTHON[QByteArray](ba);
 // @snippet qbytearray-operatorplus-2
 
 // @snippet qbytearray-operatorplus-3
-QByteArray ba = *%CPPSELF + QByteArray(PyByteArray_AsString(%PYARG_1), PyByteArray_Size(%PYARG_1));
+// operator+ copies the right hand side, a raw data view suffices.
+QByteArray ba = *%CPPSELF + QByteArray::fromRawData(PyByteArray_AsString(%PYARG_1),
+                                                    PyByteArray_Size(%PYARG_1));
 %PYARG_0 = %CONVERTTOPYTHON[QByteArray](ba);
 // @snippet qbytearray-operatorplus-3
 
 // @snippet qbytearray-operatorplusequal
-*%CPPSELF += QByteArray(PyByteArray_AsString(%PYARG_1), PyByteArray_Size(%PYARG_1));
+%CPPSELF.append(PyByteArray_AsString(%PYARG_1), PyByteArray_Size(%PYARG_1));
 // @snippet qbytearray-operatorplusequal
 
 // @snippet qbytearray-operatorequalequal
@@ -859,6 +952,36 @@ QByteArray ba(1 + qsizetype(%2), char(0));
 %PYARG_0 = Shiboken::String::fromCString(ba.constData());
 // @snippet qiodevice-readdata
 
+// @snippet qiodevice-write
+// Write the data of any contiguous buffer without converting it to a
+// QByteArray first. QByteArray instances are passed as is since the device
+// may share them.
+qint64 size = -1;
+if (PyObject_TypeCheck(%PYARG_1, Shiboken::SbkType<QByteArray>())) {
+    auto data = %CONVERTTOCPP[QByteArray *](%PYARG_1);
+    Py_BEGIN_ALLOW_THREADS
+    size = %CPPSELF.%FUNCTION_NAME(*data);
+    Py_END_ALLOW_THREADS
+} else {
+    Shiboken::Buffer::ScopedView view(%PYARG_1);
+    if (view.isValid()) {
+        Py_BEGIN_ALLOW_THREADS
+        size = %CPPSELF.%FUNCTION_NAME(view.constData(), qint64(view.size()));
+        Py_END_ALLOW_THREADS
+    } else {
+        PyErr_Format(PyExc_TypeError, "%FUNCTION_NAME() requires a contiguous buffer, got %s.",
+                     Py_TYPE(%PYARG_1)->tp_name);
+    }
+}
+if (!PyErr_Occurred())
+    %PYARG_0 = %CONVERTTOPYTHON[qint64](size);
+// @snippet qiodevice-write
+
+// @snippet qpycolumntablemodel-addcolumn
+// Raises TypeError for objects that are neither buffers nor sequences.
+%CPPSELF.%FUNCTION_NAME(%PYARG_1, %2);
+// @snippet qpycolumntablemodel-addcolumn
+
 // @snippet qcryptographichash-adddata
 %CPPSELF.%FUNCTION_NAME(Shiboken::String::toCString(%PYARG_1), Shiboken::String::len(%PYARG_1));
 // @snippet qcryptographichash-adddata
@@ -1424,13 +1547,11 @@ return PyLong_FromUnsignedLong(%in);
 // @snippet return-pylong-quintptr
 
 // @snippet return-pyunicode
-QByteArray ba = %in.toUtf8();
-return PyUnicode_FromStringAndSize(ba.constData(), ba.size());
+return PySide::qStringToPyUnicode(%in);
 // @snippet return-pyunicode
 
 // @snippet return-pyunicode-from-qanystringview
-QByteArray ba = %in.toString().toUtf8();
-return PyUnicode_FromStringAndSize(ba.constData(), ba.size());
+return PySide::qAnyStringToPyUnicode(%in);
 // @snippet return-pyunicode-from-qanystringview
 
 // @snippet return-pyunicode-qchar
@@ -1467,6 +1588,9 @@ default:
     break;
 }
 
+if (PyObject *numberList = QVariant_convertNumberListToPython(%in))
+    return numberList;
+
 Shiboken::Conversions::SpecificConverter converter(cppInRef.typeName());
 if (converter) {
    void *ptr = cppInRef.data();
@@ -569,8 +569,19 @@ PyTuple_SET_ITEM(%PYARG_0, 1, %CONVERTTOPYTHON[%ARG1_TYPE](%1));
 // @snippet qclipboard-text
 
 // @snippet qpainter-drawpointsnp-numpy-x-y
-const auto points = PySide::Numpy::xyDataToQPointFList(%PYARG_1, %PYARG_2);
-%CPPSELF.drawPoints(points);
+// The list is reused between calls; it is taken out of the cache during the
+// call for reentrancy (paint events of other widgets).
+static QList<QPointF> drawPointsNpPoints;
+QList<QPointF> points;
+points.swap(drawPointsNpPoints);
+if (PySide::Numpy::xyDataToQPointFList(%PYARG_1, %PYARG_2, &points)) {
+    %CPPSELF.drawPoints(points);
+} else {
+    PyErr_SetString(PyExc_TypeError,
+                    "drawPointsNp(): x and y must be one-dimensional arrays of a numeric type in native byte order.");
+}
+if (points.isDetached())
+    drawPointsNpPoints.swap(points);
 // @snippet qpainter-drawpointsnp-numpy-x-y
 
 // @snippet qpainter-drawpolygon
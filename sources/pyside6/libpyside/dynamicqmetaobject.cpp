@@ -39,6 +39,8 @@
 
 #include "dynamicqmetaobject.h"
 #include "dynamicqmetaobject_p.h"
+#include "pyside_p.h"
+#include "pysidemetafunction_p.h"
 #include "pysideqobject.h"
 #include "pysidesignal.h"
 #include "pysidesignal_p.h"
@@ -46,6 +48,7 @@
 #include "pysideproperty_p.h"
 #include "pysideslot_p.h"
 #include "pysideqenum.h"
+#include "signalmanager.h"
 
 #include <shiboken.h>
 
@@ -56,7 +59,13 @@
 #include <QtCore/QList>
 #include <private/qmetaobjectbuilder_p.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 using namespace PySide;
@@ -75,10 +84,237 @@ using namespace PySide;
 // instantiate a QMetaObjectBuilder and add the methods/properties
 // found by inspecting the Python class.
 
+// Reclamation of superseded meta objects: A meta call in flight may still
+// use the meta object that was current when it started (QMetaMethod
+// instances up the stack or in other threads) while Python code run by it
+// causes a rebuild. Meta calls are therefore wrapped in a MetaCallGuard,
+// which publishes the epoch at which the outermost call of the thread
+// started. Superseded meta objects are stamped with the epoch of their
+// retirement and freed when all calls in flight started later. The last
+// superseded meta object is kept as a grace generation for callers that
+// obtained it by QObject::metaObject() just before the rebuild.
+//
+// Superseded meta objects may also still be referenced beyond meta calls:
+// Builders of Python subclasses and of instances with dynamic methods use
+// them as super class, and Python wrappers of QMetaObject, QMetaMethod, etc.
+// point into them. Those references pin the meta object. Pinned meta objects
+// are not reclaimed; if their builder is destroyed, they are orphaned and
+// freed when the last pin is released.
+//
+// Meta objects handed to Qt, which may cache them anywhere (QML type
+// registration, property caches of instances exposed to QML), are pinned
+// permanently, and their builders keep all superseded meta objects.
+
+static constexpr quint64 idleEpoch = std::numeric_limits<quint64>::max();
+
+static std::atomic<quint64> metaObjectEpoch{0};
+static std::atomic<quint64> reclaimedMetaObjects{0};
+
+namespace {
+
+struct ThreadEpoch
+{
+    std::atomic<quint64> epoch{idleEpoch};
+    int depth = 0;
+};
+
+struct ThreadEpochs
+{
+    std::mutex mutex;
+    std::vector<const ThreadEpoch *> epochs;
+};
+
+ThreadEpochs &threadEpochs()
+{
+    static auto *result = new ThreadEpochs; // Used by thread_local dtors, leaked
+    return *result;
+}
+
+struct ThreadEpochRegistration
+{
+    ThreadEpochRegistration()
+    {
+        auto &t = threadEpochs();
+        std::lock_guard<std::mutex> lock(t.mutex);
+        t.epochs.push_back(&threadEpoch);
+    }
+
+    ~ThreadEpochRegistration()
+    {
+        auto &t = threadEpochs();
+        std::lock_guard<std::mutex> lock(t.mutex);
+        t.epochs.erase(std::find(t.epochs.begin(), t.epochs.end(), &threadEpoch));
+    }
+
+    ThreadEpoch threadEpoch;
+};
+
+} // namespace
+
+static ThreadEpoch &currentThreadEpoch()
+{
+    static thread_local ThreadEpochRegistration registration;
+    return registration.threadEpoch;
+}
+
+// Returns the epoch of the oldest meta call in flight.
+static quint64 oldestActiveEpoch()
+{
+    quint64 result = idleEpoch;
+    auto &t = threadEpochs();
+    std::lock_guard<std::mutex> lock(t.mutex);
+    for (const auto *threadEpoch : t.epochs)
+        result = std::min(result, threadEpoch->epoch.load());
+    return result;
+}
+
+namespace PySide
+{
+
+MetaCallGuard::MetaCallGuard()
+{
+    auto &threadEpoch = currentThreadEpoch();
+    if (threadEpoch.depth++ == 0) {
+        // Retry until the published epoch is not older than a concurrent
+        // retirement, so that it is taken into account by its reclamation.
+        quint64 epoch = metaObjectEpoch.load();
+        while (true) {
+            threadEpoch.epoch.store(epoch);
+            const quint64 current = metaObjectEpoch.load();
+            if (current == epoch)
+                break;
+            epoch = current;
+        }
+    }
+}
+
+MetaCallGuard::~MetaCallGuard()
+{
+    auto &threadEpoch = currentThreadEpoch();
+    if (--threadEpoch.depth == 0)
+        threadEpoch.epoch.store(idleEpoch);
+}
+
+quint64 reclaimedMetaObjectCount()
+{
+    return reclaimedMetaObjects.load(std::memory_order_relaxed);
+}
+
+} // namespace PySide
+
+static void invalidateMetaObjectCaches(const QMetaObject *metaObject)
+{
+    SignalManager::invalidateMethodCache(metaObject);
+    MetaFunction::invalidateCache(metaObject);
+    invalidateQObjectTypeCache(metaObject);
+}
+
+// Frees a meta object. The caches are invalidated again since calls in
+// flight may have repopulated them after the meta object was superseded.
+static void freeMetaObject(const QMetaObject *metaObject)
+{
+    invalidateMetaObjectCaches(metaObject);
+    free(const_cast<QMetaObject*>(metaObject));
+    reclaimedMetaObjects.fetch_add(1, std::memory_order_relaxed);
+}
+
+namespace {
+
+struct MetaObjectPins
+{
+    std::mutex mutex;
+    std::unordered_map<const QMetaObject *, int> counts;
+    std::unordered_set<const QMetaObject *> orphans;
+};
+
+MetaObjectPins &metaObjectPins()
+{
+    static auto *result = new MetaObjectPins; // Used by capsule dtors, leaked
+    return *result;
+}
+
+} // namespace
+
+static void pinMetaObject(const QMetaObject *metaObject)
+{
+    auto &pins = metaObjectPins();
+    std::lock_guard<std::mutex> lock(pins.mutex);
+    ++pins.counts[metaObject];
+}
+
+static void unpinMetaObject(const QMetaObject *metaObject)
+{
+    bool orphaned = false;
+    {
+        auto &pins = metaObjectPins();
+        std::lock_guard<std::mutex> lock(pins.mutex);
+        auto it = pins.counts.find(metaObject);
+        Q_ASSERT(it != pins.counts.end());
+        if (--it->second == 0) {
+            pins.counts.erase(it);
+            orphaned = pins.orphans.erase(metaObject) != 0;
+        }
+    }
+    if (orphaned)
+        freeMetaObject(metaObject);
+}
+
+static bool isMetaObjectPinned(const QMetaObject *metaObject)
+{
+    auto &pins = metaObjectPins();
+    std::lock_guard<std::mutex> lock(pins.mutex);
+    return pins.counts.find(metaObject) != pins.counts.end();
+}
+
+// Frees a meta object of a destroyed builder unless it is pinned.
+static void releaseMetaObject(const QMetaObject *metaObject)
+{
+    {
+        auto &pins = metaObjectPins();
+        std::lock_guard<std::mutex> lock(pins.mutex);
+        if (pins.counts.find(metaObject) != pins.counts.end()) {
+            pins.orphans.insert(metaObject);
+            return;
+        }
+    }
+    freeMetaObject(metaObject);
+}
+
+static void unpinMetaObjectCapsule(PyObject *capsule)
+{
+    unpinMetaObject(reinterpret_cast<const QMetaObject *>(PyCapsule_GetPointer(capsule, nullptr)));
+}
+
+namespace PySide
+{
+
+void keepMetaObjectAlive(PyObject *pyObj, const QMetaObject *metaObject)
+{
+    if (pyObj == nullptr || metaObject == nullptr || !Shiboken::Object::checkType(pyObj))
+        return;
+    static PyObject *const pinAttr = Shiboken::String::createStaticString("__METAOBJECT_PIN__");
+    PyObject *dict = SbkObject_GetDict(pyObj);
+    if (dict == nullptr || PyDict_Contains(dict, pinAttr) != 0)
+        return;
+    Shiboken::AutoDecRef capsule(PyCapsule_New(const_cast<QMetaObject *>(metaObject), nullptr,
+                                               unpinMetaObjectCapsule));
+    if (capsule.isNull())
+        return;
+    pinMetaObject(metaObject);
+    PyDict_SetItem(dict, pinAttr, capsule.object());
+}
+
+} // namespace PySide
+
 class MetaObjectBuilderPrivate
 {
 public:
-    using MetaObjects = std::vector<const QMetaObject *>;
+    struct RetiredMetaObject
+    {
+        quint64 epoch;
+        const QMetaObject *metaObject;
+    };
+    using RetiredMetaObjects = std::vector<RetiredMetaObject>;
 
     QMetaObjectBuilder *ensureBuilder();
     void parsePythonType(PyTypeObject *type);
@@ -97,12 +333,15 @@ public:
                        const MetaObjectBuilder::EnumValues &entries);
     void removeProperty(int index);
     const QMetaObject *update();
+    void reclaimMetaObjects();
 
     QMetaObjectBuilder *m_builder = nullptr;
 
     const QMetaObject *m_baseObject = nullptr;
-    MetaObjects m_cachedMetaObjects;
+    const QMetaObject *m_metaObject = nullptr;
+    RetiredMetaObjects m_retiredMetaObjects;
     bool m_dirty = true;
+    bool m_retainMetaObjects = false;
 };
 
 QMetaObjectBuilder *MetaObjectBuilderPrivate::ensureBuilder()
@@ -119,6 +358,7 @@ MetaObjectBuilder::MetaObjectBuilder(const char *className, const QMetaObject *m
     m_d(new MetaObjectBuilderPrivate)
 {
     m_d->m_baseObject = metaObject;
+    pinMetaObject(metaObject);
     m_d->m_builder = new QMetaObjectBuilder();
     m_d->m_builder->setClassName(className);
     m_d->m_builder->setSuperClass(metaObject);
@@ -129,6 +369,7 @@ MetaObjectBuilder::MetaObjectBuilder(PyTypeObject *type, const QMetaObject *meta
     : m_d(new MetaObjectBuilderPrivate)
 {
     m_d->m_baseObject = metaObject;
+    pinMetaObject(metaObject);
     const char *className = type->tp_name;
     if (const char *lastDot = strrchr(type->tp_name, '.'))
         className = lastDot + 1;
@@ -144,8 +385,11 @@ MetaObjectBuilder::MetaObjectBuilder(PyTypeObject *type, const QMetaObject *meta
 
 MetaObjectBuilder::~MetaObjectBuilder()
 {
-    for (auto *metaObject : m_d->m_cachedMetaObjects)
-        free(const_cast<QMetaObject*>(metaObject));
+    for (const auto &retired : m_d->m_retiredMetaObjects)
+        releaseMetaObject(retired.metaObject);
+    if (m_d->m_metaObject != nullptr)
+        releaseMetaObject(m_d->m_metaObject);
+    unpinMetaObject(m_d->m_baseObject);
     delete m_d->m_builder;
     delete m_d;
 }
@@ -439,16 +683,46 @@ const QMetaObject *MetaObjectBuilderPrivate::update()
 {
     if (!m_builder)
         return m_baseObject;
-    if (m_cachedMetaObjects.empty() || m_dirty) {
+    if (m_metaObject == nullptr || m_dirty) {
         // PYSIDE-803: The dirty branch needs to be protected by the GIL.
         // This was moved from SignalManager::retrieveMetaObject to here,
         // which is only the update in "return builder->update()".
         Shiboken::GilState gil;
-        m_cachedMetaObjects.push_back(m_builder->toMetaObject());
-        checkMethodOrder(m_cachedMetaObjects.back());
+        const QMetaObject *superseded = m_metaObject;
+        m_metaObject = m_builder->toMetaObject();
+        checkMethodOrder(m_metaObject);
         m_dirty = false;
+        if (superseded != nullptr) {
+            // The converters cached for the superseded meta object are stale.
+            invalidateMetaObjectCaches(superseded);
+            m_retiredMetaObjects.push_back({metaObjectEpoch.fetch_add(1), superseded});
+            reclaimMetaObjects();
+        }
     }
-    return m_cachedMetaObjects.back();
+    return m_metaObject;
+}
+
+// Frees the superseded meta objects retired before the oldest meta call in
+// flight started, except for the grace generation and pinned ones.
+void MetaObjectBuilderPrivate::reclaimMetaObjects()
+{
+    if (m_retainMetaObjects || m_retiredMetaObjects.size() < 2)
+        return;
+    const quint64 oldestEpoch = oldestActiveEpoch();
+    const auto grace = m_retiredMetaObjects.end() - 1;
+    auto kept = m_retiredMetaObjects.begin();
+    for (auto it = kept; it != grace; ++it) {
+        if (it->epoch < oldestEpoch && !isMetaObjectPinned(it->metaObject))
+            freeMetaObject(it->metaObject);
+        else
+            *kept++ = *it;
+    }
+    m_retiredMetaObjects.erase(kept, grace);
+}
+
+int MetaObjectBuilder::retainedMetaObjectCount() const
+{
+    return int(m_d->m_retiredMetaObjects.size()) + (m_d->m_metaObject != nullptr ? 1 : 0);
 }
 
 const QMetaObject *MetaObjectBuilder::update()
@@ -456,6 +730,21 @@ const QMetaObject *MetaObjectBuilder::update()
     return m_d->update();
 }
 
+const QMetaObject *MetaObjectBuilder::retainMetaObject()
+{
+    const QMetaObject *result = m_d->update();
+    m_d->m_retainMetaObjects = true;
+    // Never unpinned, so that it survives the builder.
+    if (result != m_d->m_baseObject)
+        pinMetaObject(result);
+    return result;
+}
+
+bool MetaObjectBuilder::retainsMetaObjects() const
+{
+    return m_d->m_retainMetaObjects;
+}
+
 using namespace Shiboken;
 
 void MetaObjectBuilderPrivate::parsePythonType(PyTypeObject *type)
@@ -77,6 +77,17 @@ public:
 
     const QMetaObject *update();
 
+    /// Returns the number of meta objects kept by the builder, that is,
+    /// the current one and superseded ones that may still be in use.
+    int retainedMetaObjectCount() const;
+
+    /// Returns the current meta object for handing it to Qt, which may cache
+    /// it (QML type registration, property caches of instances). It is never
+    /// freed, and superseded meta objects are kept until the builder is
+    /// destroyed.
+    const QMetaObject *retainMetaObject();
+    bool retainsMetaObjects() const;
+
 private:
     MetaObjectBuilderPrivate *m_d;
 };
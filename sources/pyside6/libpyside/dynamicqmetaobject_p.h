@@ -48,6 +48,20 @@
 struct PySideProperty;
 namespace PySide
 {
+    /// Marks a meta call in flight for the reclamation of superseded meta
+    /// objects of MetaObjectBuilder, see dynamicqmetaobject.cpp.
+    class MetaCallGuard
+    {
+    public:
+        Q_DISABLE_COPY_MOVE(MetaCallGuard)
+
+        MetaCallGuard();
+        ~MetaCallGuard();
+    };
+
+    /// Returns the number of meta objects freed so far. Caches keyed by
+    /// meta object pointers need to be revalidated when it changes.
+    quint64 reclaimedMetaObjectCount();
     class MethodData
     {
     public:
@@ -67,18 +67,25 @@
 #include <sbkstring.h>
 #include <sbkstaticstrings.h>
 
+#include <QtCore/QAnyStringView>
 #include <QtCore/QByteArray>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
+#include <QtCore/QHash>
 #include <QtCore/QMutex>
-#include <QtCore/QSharedPointer>
+#include <QtCore/QPair>
+#include <QtCore/QSet>
 #include <QtCore/QStack>
-#include <QtCore/QThread>
+#include <QtCore/QStringView>
+#include <QtCore/QSysInfo>
+#include <private/qhooks_p.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <cctype>
+#include <type_traits>
 #include <typeinfo>
 
 static QStack<PySide::CleanupFunction> cleanupFunctionList;
@@ -92,6 +99,8 @@ QT_END_NAMESPACE
 namespace PySide
 {
 
+static void installRemoveQObjectHook();
+
 void init(PyObject *module)
 {
     qobjectNextAddr = nullptr;
@@ -102,6 +111,7 @@ void init(PyObject *module)
     Property::init(module);
     ClassProperty::init(module);
     MetaFunction::init(module);
+    installRemoveQObjectHook();
     // Init signal manager, so it will register some meta types used by QVariant.
     SignalManager::instance();
     initQApp();
@@ -231,6 +241,8 @@ std::size_t getSizeOfQObject(PyTypeObject *type)
 
 void initDynamicMetaObject(PyTypeObject *type, const QMetaObject *base, std::size_t cppObjSize)
 {
+    // A new binding type may be a better match for QObjects returned from C++.
+    invalidateQObjectTypeCache();
     //create DynamicMetaObject based on python type
     auto userData = new TypeUserData(reinterpret_cast<PyTypeObject *>(type), base, cppObjSize);
     userData->mo.update();
@@ -271,6 +283,12 @@ const QMetaObject *retrieveMetaObject(PyObject *pyObj)
     return retrieveMetaObject(pyTypeObj);
 }
 
+const QMetaObject *retainMetaObject(PyTypeObject *pyTypeObj)
+{
+    TypeUserData *userData = retrieveTypeUserData(pyTypeObj);
+    return userData ? userData->mo.retainMetaObject() : nullptr;
+}
+
 void initQObjectSubType(PyTypeObject *type, PyObject *args, PyObject * /* kwds */)
 {
     PyTypeObject *qObjType = Shiboken::Conversions::getPythonTypeObject("QObject*");
@@ -404,27 +422,66 @@ void setNextQObjectMemoryAddr(void *addr)
     qobjectNextAddr = addr;
 }
 
-} // namespace PySide
-
-// A QSharedPointer is used with a deletion function to invalidate a pointer
-// when the property value is cleared.  This should be a QSharedPointer with
-// a void *pointer, but that isn't allowed
-typedef char any_t;
-Q_DECLARE_METATYPE(QSharedPointer<any_t>);
+// Objects wrapped by getWrapperForQObject() whose wrappers are to be released
+// when they are deleted from C++. Deletions are observed by a RemoveQObject
+// hook instead of a dynamic property per object, which sends a
+// QEvent::DynamicPropertyChange and works for objects of the current thread only.
+// The hook runs for every QObject destroyed in the process, so the set is
+// guarded by a counting filter indexed by address: objects whose slot is zero
+// were never wrapped and skip the mutex. Slots are only modified under the
+// mutex; a deleted object cannot be wrapped concurrently.
+static QMutex wrappedQObjectsMutex;
+static QSet<const QObject *> wrappedQObjects;
+static constexpr std::size_t wrappedQObjectsFilterSize = 4096;
+static std::atomic<quint32> wrappedQObjectsFilter[wrappedQObjectsFilterSize];
+static QHooks::RemoveQObjectCallback previousRemoveQObjectHook = nullptr;
+
+static inline std::atomic<quint32> &wrappedQObjectsFilterSlot(const QObject *object)
+{
+    // Drop the low bits, which are equal due to alignment and allocation granularity
+    const auto addr = reinterpret_cast<quintptr>(object) >> 4;
+    return wrappedQObjectsFilter[(addr ^ (addr >> 12)) % wrappedQObjectsFilterSize];
+}
 
-namespace PySide
+static void insertWrappedQObject(const QObject *object)
 {
+    QMutexLocker locker(&wrappedQObjectsMutex);
+    if (!wrappedQObjects.contains(object)) {
+        wrappedQObjects.insert(object);
+        wrappedQObjectsFilterSlot(object).fetch_add(1, std::memory_order_release);
+    }
+}
 
-static void invalidatePtr(any_t *object)
+static void removeQObjectHook(QObject *object)
 {
-    Shiboken::GilState state;
-
-    SbkObject *wrapper = Shiboken::BindingManager::instance().retrieveWrapper(object);
-    if (wrapper != nullptr)
-        Shiboken::BindingManager::instance().releaseWrapper(wrapper);
+    bool wrapped = false;
+    if (wrappedQObjectsFilterSlot(object).load(std::memory_order_acquire) != 0) {
+        QMutexLocker locker(&wrappedQObjectsMutex);
+        wrapped = wrappedQObjects.remove(object);
+        if (wrapped)
+            wrappedQObjectsFilterSlot(object).fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (wrapped && Py_IsInitialized()) {
+        Shiboken::GilState state;
+        auto &bindingManager = Shiboken::BindingManager::instance();
+        if (SbkObject *wrapper = bindingManager.retrieveWrapper(object))
+            bindingManager.releaseWrapper(wrapper);
+    }
+    if (previousRemoveQObjectHook != nullptr)
+        previousRemoveQObjectHook(object);
 }
 
-static const char invalidatePropertyName[] = "_PySideInvalidatePtr";
+static void installRemoveQObjectHook()
+{
+    static bool installed = false;
+    if (installed)
+        return;
+    installed = true;
+    // Chain a hook installed by tools like GammaRay.
+    previousRemoveQObjectHook =
+        reinterpret_cast<QHooks::RemoveQObjectCallback>(qtHookData[QHooks::RemoveQObject]);
+    qtHookData[QHooks::RemoveQObject] = reinterpret_cast<quintptr>(&removeQObjectHook);
+}
 
 // PYSIDE-1214, when creating new wrappers for classes inheriting QObject but
 // not exposed to Python, try to find the best-matching (most-derived) Qt
@@ -444,6 +501,40 @@ static const char *typeName(const QObject *cppSelf)
     return typeName;
 }
 
+// Cache of the types resolved by typeName() by meta object and dynamic type,
+// sparing the lookups by name for each QObject returned from C++.
+struct QObjectType
+{
+    const char *typeName;
+    PyTypeObject *pyType;
+};
+
+static QHash<const QMetaObject *, QHash<const std::type_info *, QObjectType>> qobjectTypeCache;
+
+static QObjectType qobjectType(const QObject *cppSelf)
+{
+    const QMetaObject *metaObject = cppSelf->metaObject();
+    const std::type_info *key = &typeid(*cppSelf);
+    auto metaObjectIt = qobjectTypeCache.constFind(metaObject);
+    if (metaObjectIt != qobjectTypeCache.cend()) {
+        auto it = metaObjectIt.value().constFind(key);
+        if (it != metaObjectIt.value().cend())
+            return it.value();
+    }
+    const char *name = typeName(cppSelf);
+    const QObjectType result{name, Shiboken::ObjectType::typeForTypeName(name)};
+    qobjectTypeCache[metaObject].insert(key, result);
+    return result;
+}
+
+void invalidateQObjectTypeCache(const QMetaObject *metaObject)
+{
+    if (metaObject == nullptr)
+        qobjectTypeCache.clear();
+    else
+        qobjectTypeCache.remove(metaObject);
+}
+
 PyTypeObject *getTypeForQObject(const QObject *cppSelf)
 {
     // First check if there are any instances of Python implementations
@@ -452,10 +543,7 @@ PyTypeObject *getTypeForQObject(const QObject *cppSelf)
     if (existing != nullptr)
         return reinterpret_cast<PyObject *>(existing)->ob_type;
     // Find the best match (will return a PySide type)
-    auto *sbkObjectType = Shiboken::ObjectType::typeForTypeName(typeName(cppSelf));
-    if (sbkObjectType != nullptr)
-        return reinterpret_cast<PyTypeObject *>(sbkObjectType);
-    return nullptr;
+    return qobjectType(cppSelf).pyType;
 }
 
 PyObject *getWrapperForQObject(QObject *cppSelf, PyTypeObject *sbk_type)
@@ -466,23 +554,12 @@ PyObject *getWrapperForQObject(QObject *cppSelf, PyTypeObject *sbk_type)
         return pyOut;
     }
 
-    // Setting the property will trigger an QEvent notification, which may call into
-    // code that creates the wrapper so only set the property if it isn't already
-    // set and check if it's created after the set call
-    QVariant existing = cppSelf->property(invalidatePropertyName);
-    if (!existing.isValid()) {
-        if (cppSelf->thread() == QThread::currentThread()) {
-            QSharedPointer<any_t> shared_with_del(reinterpret_cast<any_t *>(cppSelf), invalidatePtr);
-            cppSelf->setProperty(invalidatePropertyName, QVariant::fromValue(shared_with_del));
-        }
-        pyOut = reinterpret_cast<PyObject *>(Shiboken::BindingManager::instance().retrieveWrapper(cppSelf));
-        if (pyOut) {
-            Py_INCREF(pyOut);
-            return pyOut;
-        }
-    }
+    insertWrappedQObject(cppSelf);
 
-    pyOut = Shiboken::Object::newObject(sbk_type, cppSelf, false, false, typeName(cppSelf));
+    const QObjectType type = qobjectType(cppSelf);
+    pyOut = type.pyType != nullptr
+        ? Shiboken::Object::newObject(type.pyType, cppSelf, false, true)
+        : Shiboken::Object::newObject(sbk_type, cppSelf, false, false, type.typeName);
 
     return pyOut;
 }
@@ -525,6 +602,69 @@ QString pyPathToQString(PyObject *path)
     return QDir::fromNativeSeparators(pyStringToQString(strPath));
 }
 
+// Decode UTF-16 containing surrogates, replacing lone ones.
+static PyObject *decodeUtf16(const char16_t *data, qsizetype size)
+{
+    int byteOrder = QSysInfo::ByteOrder == QSysInfo::LittleEndian ? -1 : 1;
+    return PyUnicode_DecodeUTF16(reinterpret_cast<const char *>(data),
+                                 size * Py_ssize_t(sizeof(char16_t)), "replace", &byteOrder);
+}
+
+PyObject *qStringToPyUnicode(QStringView s)
+{
+    const qsizetype size = s.size();
+    const char16_t *data = s.utf16();
+#ifdef Py_LIMITED_API
+    return decodeUtf16(data, size);
+#else
+    // Determine the kind from the OR of all code units, which is exact for
+    // the 1 byte kinds (ASCII, Latin-1). The loops are kept simple for the
+    // compiler to vectorize them.
+    char16_t bits = 0;
+    for (qsizetype i = 0; i < size; ++i)
+        bits |= data[i];
+
+    if (bits < 0x100) {
+        PyObject *result = PyUnicode_New(size, bits < 0x80 ? 0x7f : 0xff);
+        if (result == nullptr)
+            return nullptr;
+        Py_UCS1 *out = PyUnicode_1BYTE_DATA(result);
+        for (qsizetype i = 0; i < size; ++i)
+            out[i] = Py_UCS1(data[i]);
+        return result;
+    }
+
+    if (bits >= 0xd800) { // Surrogates (characters beyond the BMP) are rare
+        bool hasSurrogates = false;
+        for (qsizetype i = 0; i < size; ++i)
+            hasSurrogates |= (data[i] & 0xf800) == 0xd800;
+        if (hasSurrogates)
+            return decodeUtf16(data, size);
+    }
+
+    PyObject *result = PyUnicode_New(size, 0xffff);
+    if (result == nullptr)
+        return nullptr;
+    std::memcpy(PyUnicode_2BYTE_DATA(result), data, size_t(size) * sizeof(char16_t));
+    return result;
+#endif
+}
+
+PyObject *qAnyStringToPyUnicode(QAnyStringView s)
+{
+    return s.visit([](auto view) -> PyObject * {
+        using View = decltype(view);
+        if constexpr (std::is_same_v<View, QStringView>) {
+            return qStringToPyUnicode(view);
+        } else if constexpr (std::is_same_v<View, QLatin1String>) {
+            return PyUnicode_DecodeLatin1(view.data(), view.size(), nullptr);
+        } else {
+            return PyUnicode_DecodeUTF8(reinterpret_cast<const char *>(view.data()),
+                                        view.size(), "replace");
+        }
+    });
+}
+
 static const unsigned char qt_resource_name[] = {
   // qt
   0x0,0x2,
@@ -43,36 +43,149 @@
 #  include <numpy/arrayobject.h>
 #  include "pyside_numpy.h"
 
-// Convert X,Y of type T data to a list of points (QPoint, PointF)
-template <class T, class Point>
-static QList<Point>
-    xyDataToQPointHelper(PyArrayObject *pyX, PyArrayObject *pyY,
-                         qsizetype size)
-{
-    auto *x = reinterpret_cast<const T *>(PyArray_DATA(pyX));
-    auto *y = reinterpret_cast<const T *>(PyArray_DATA(pyY));
-    QList<Point> result;
-    result.reserve(size);
-    for (auto xEnd = x + size; x < xEnd; ++x, ++y)
-        result.append(Point(*x, *y));
+#  include <cstring>
+#  include <type_traits>
+
+// Distinguish numpy half precision floats (IEEE 754 binary16) from
+// npy_half, which is a typedef of unsigned short.
+struct HalfFloat
+{
+    npy_half bits;
+};
+
+static float halfToFloat(HalfFloat half)
+{
+    const npy_half h = half.bits;
+    const quint32 sign = quint32(h & 0x8000u) << 16;
+    quint32 exponent = (h >> 10) & 0x1fu;
+    quint32 mantissa = h & 0x3ffu;
+    quint32 bits;
+    if (exponent == 0x1fu) { // Inf/NaN
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    } else if (exponent != 0) { // Normalized
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    } else if (mantissa != 0) { // Subnormal: normalize it
+        exponent = 113;
+        while ((mantissa & 0x400u) == 0) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+    } else { // Zero
+        bits = sign;
+    }
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
     return result;
 }
 
-// Convert X,Y of double/float type data to a list of QPoint (rounding)
-template <class T>
-static QList<QPoint>
-    xyFloatDataToQPointHelper(PyArrayObject *pyX, PyArrayObject *pyY,
-                              qsizetype size)
+// Convert a value to a point coordinate, rounding floating point values
+// for integer points (QPoint).
+template <class Coordinate, class T>
+static inline Coordinate toCoordinate(T value)
 {
-    auto *x = reinterpret_cast<const T *>(PyArray_DATA(pyX));
-    auto *y = reinterpret_cast<const T *>(PyArray_DATA(pyY));
-    QList<QPoint> result;
-    result.reserve(size);
-    for (auto xEnd = x + size; x < xEnd; ++x, ++y)
-        result.append(QPoint(qRound(*x), qRound(*y)));
-    return result;
+    if constexpr (std::is_same_v<T, HalfFloat>)
+        return toCoordinate<Coordinate>(halfToFloat(value));
+    else if constexpr (std::is_integral_v<Coordinate> && std::is_floating_point_v<T>)
+        return qRound(value);
+    else
+        return Coordinate(value);
+}
+
+// Copy a vector of T into every second element of out, that is, the x or y
+// coordinates of a list of points. The contiguous case is a plain loop which
+// the compiler can vectorize; the strided case also handles unaligned data.
+template <class T, class Coordinate>
+static void copyCoordinates(const char *data, npy_intp stride, bool aligned,
+                            qsizetype size, Coordinate *out)
+{
+    if (aligned && stride == npy_intp(sizeof(T))) {
+        auto *in = reinterpret_cast<const T *>(data);
+        for (qsizetype i = 0; i < size; ++i)
+            out[2 * i] = toCoordinate<Coordinate>(in[i]);
+    } else {
+        for (qsizetype i = 0; i < size; ++i, data += stride) {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            out[2 * i] = toCoordinate<Coordinate>(value);
+        }
+    }
+}
+
+template <class Coordinate>
+static bool copyCoordinates(PyArrayObject *pyArray, qsizetype size, Coordinate *out)
+{
+    const char *data = PyArray_BYTES(pyArray);
+    const npy_intp stride = PyArray_STRIDES(pyArray)[0];
+    const bool aligned = PyArray_ISALIGNED(pyArray);
+    switch (PyArray_TYPE(pyArray)) {
+    case NPY_BYTE:
+        copyCoordinates<npy_byte>(data, stride, aligned, size, out);
+        break;
+    case NPY_UBYTE:
+        copyCoordinates<npy_ubyte>(data, stride, aligned, size, out);
+        break;
+    case NPY_SHORT:
+        copyCoordinates<npy_short>(data, stride, aligned, size, out);
+        break;
+    case NPY_USHORT:
+        copyCoordinates<npy_ushort>(data, stride, aligned, size, out);
+        break;
+    case NPY_INT:
+        copyCoordinates<npy_int>(data, stride, aligned, size, out);
+        break;
+    case NPY_UINT:
+        copyCoordinates<npy_uint>(data, stride, aligned, size, out);
+        break;
+    case NPY_LONG:
+        copyCoordinates<npy_long>(data, stride, aligned, size, out);
+        break;
+    case NPY_ULONG:
+        copyCoordinates<npy_ulong>(data, stride, aligned, size, out);
+        break;
+    case NPY_LONGLONG:
+        copyCoordinates<npy_longlong>(data, stride, aligned, size, out);
+        break;
+    case NPY_ULONGLONG:
+        copyCoordinates<npy_ulonglong>(data, stride, aligned, size, out);
+        break;
+    case NPY_HALF:
+        copyCoordinates<HalfFloat>(data, stride, aligned, size, out);
+        break;
+    case NPY_FLOAT:
+        copyCoordinates<npy_float>(data, stride, aligned, size, out);
+        break;
+    case NPY_DOUBLE:
+        copyCoordinates<npy_double>(data, stride, aligned, size, out);
+        break;
+    default:
+        return false;
+    }
+    return true;
 }
 
+static bool isSupportedType(int numpytype)
+{
+    switch (numpytype) {
+    case NPY_BYTE:
+    case NPY_UBYTE:
+    case NPY_SHORT:
+    case NPY_USHORT:
+    case NPY_INT:
+    case NPY_UINT:
+    case NPY_LONG:
+    case NPY_ULONG:
+    case NPY_LONGLONG:
+    case NPY_ULONGLONG:
+    case NPY_HALF:
+    case NPY_FLOAT:
+    case NPY_DOUBLE:
+        return true;
+    default:
+        break;
+    }
+    return false;
+}
 
 namespace PySide::Numpy
 {
@@ -88,73 +201,62 @@ bool check(PyObject *pyIn)
     return PyArray_Check(pyIn);
 }
 
-struct XyCheck
+// Check whether the array is a 1 dimensional vector of a supported type
+// in native byte order (the elements may be strided).
+static bool checkVector(PyArrayObject *pyArray)
 {
-    qsizetype size;
-    int numpytype;
-};
+    return PyArray_NDIM(pyArray) == 1 && PyArray_ISNOTSWAPPED(pyArray)
+        && isSupportedType(PyArray_TYPE(pyArray));
+}
 
-// Check whether pyXIn and pyYIn are 1 dimensional vectors of the same size.
-// Return -1, -1 on failure.
-static XyCheck checkXyData(PyArrayObject *pyX, PyArrayObject *pyY)
-{
-    XyCheck result{-1, -1};
-    if (PyArray_NDIM(pyX) != 1 || (PyArray_FLAGS(pyX) & NPY_ARRAY_C_CONTIGUOUS) == 0)
-        return result;
-    if (PyArray_NDIM(pyY) != 1 || (PyArray_FLAGS(pyY) & NPY_ARRAY_C_CONTIGUOUS) == 0)
-        return result;
-    const int xType = PyArray_TYPE(pyX);
-    const int yType = PyArray_TYPE(pyY);
-    if (xType != yType)
-        return result;
-    result.numpytype = xType;
-    result.size = qMin(PyArray_DIMS(pyX)[0], PyArray_DIMS(pyY)[0]);
-    return result;
+// Check whether pyXIn and pyYIn are 1 dimensional vectors and return the
+// number of points or -1 on failure.
+static qsizetype checkXyData(PyArrayObject *pyX, PyArrayObject *pyY)
+{
+    if (!checkVector(pyX) || !checkVector(pyY))
+        return -1;
+    return qMin(PyArray_DIMS(pyX)[0], PyArray_DIMS(pyY)[0]);
 }
 
-QList<QPointF> xyDataToQPointFList(PyObject *pyXIn, PyObject *pyYIn)
+// Fill a list of points by writing the x and y coordinates in 2 passes
+// directly into its storage, which is reused if possible.
+template <class Point>
+static bool xyDataToPoints(PyObject *pyXIn, PyObject *pyYIn, QList<Point> *points)
 {
+    using Coordinate = std::remove_reference_t<decltype(std::declval<Point &>().rx())>;
+    static_assert(sizeof(Point) == 2 * sizeof(Coordinate));
+
     auto *pyX = reinterpret_cast<PyArrayObject *>(pyXIn);
     auto *pyY = reinterpret_cast<PyArrayObject *>(pyYIn);
-    XyCheck check = checkXyData(pyX, pyY);
-    if (check.size <= 0)
-        return {};
-    switch (check.numpytype) {
-    case NPY_INT:
-        return xyDataToQPointHelper<int, QPointF>(pyX, pyY, check.size);
-    case NPY_UINT:
-        return xyDataToQPointHelper<unsigned, QPointF>(pyX, pyY, check.size);
-    case NPY_FLOAT:
-        return xyDataToQPointHelper<float, QPointF>(pyX, pyY, check.size);
-    case NPY_DOUBLE:
-        return xyDataToQPointHelper<double, QPointF>(pyX, pyY, check.size);
-    default:
-        break;
+    const qsizetype size = checkXyData(pyX, pyY);
+    if (size < 0) {
+        points->clear();
+        return false;
     }
-    return {};
+    points->resize(size);
+    if (size == 0)
+        return true;
+    auto *out = reinterpret_cast<Coordinate *>(points->data());
+    return copyCoordinates(pyX, size, out) && copyCoordinates(pyY, size, out + 1);
 }
 
-QList<QPoint> xyDataToQPointList(PyObject *pyXIn, PyObject *pyYIn)
+bool xyDataToQPointFList(PyObject *pyXIn, PyObject *pyYIn, QList<QPointF> *points)
 {
-    auto *pyX = reinterpret_cast<PyArrayObject *>(pyXIn);
-    auto *pyY = reinterpret_cast<PyArrayObject *>(pyYIn);
-    XyCheck check = checkXyData(pyX, pyY);
-    if (check.size <= 0)
-        return {};
-    switch (check.numpytype) {
-    case NPY_INT:
-        return xyDataToQPointHelper<int, QPoint>(pyX, pyY, check.size);
-    case NPY_UINT:
-        return xyDataToQPointHelper<unsigned, QPoint>(pyX, pyY, check.size);
-    case NPY_FLOAT:
-        return xyFloatDataToQPointHelper<float>(pyX, pyY, check.size);
-    case NPY_DOUBLE:
-        return xyFloatDataToQPointHelper<double>(pyX, pyY, check.size);
-    default:
-        break;
-    }
+    return xyDataToPoints(pyXIn, pyYIn, points);
+}
 
-    return {};
+QList<QPointF> xyDataToQPointFList(PyObject *pyXIn, PyObject *pyYIn)
+{
+    QList<QPointF> result;
+    xyDataToPoints(pyXIn, pyYIn, &result);
+    return result;
+}
+
+QList<QPoint> xyDataToQPointList(PyObject *pyXIn, PyObject *pyYIn)
+{
+    QList<QPoint> result;
+    xyDataToPoints(pyXIn, pyYIn, &result);
+    return result;
 }
 
 } //namespace PySide::Numpy
@@ -180,6 +282,13 @@ QList<QPointF> xyDataToQPointFList(PyObject *, PyObject *)
     return {};
 }
 
+bool xyDataToQPointFList(PyObject *, PyObject *, QList<QPointF> *points)
+{
+    qWarning("Unimplemented function %s, (numpy was not found).", __FUNCTION__);
+    points->clear();
+    return false;
+}
+
 QList<QPoint> xyDataToQPointList(PyObject *, PyObject *)
 {
     qWarning("Unimplemented function %s, (numpy was not found).", __FUNCTION__);
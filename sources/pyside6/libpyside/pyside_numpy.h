@@ -63,16 +63,27 @@ bool init();
 /// \return Whether it is a PyArrayObject
 PYSIDE_API bool check(PyObject *pyIn);
 
-/// Create a list of QPointF from 2 equally sized numpy array of x and y data
-/// (float,double).
+/// Create a list of QPointF from 2 numpy vectors of x and y data of
+/// integer or floating point types (including float16). The vectors may
+/// be strided and of different types; excess elements are ignored.
 /// \param pyXIn X data array
 /// \param pyYIn Y data array
 /// \return List of QPointF
 
 PYSIDE_API QList<QPointF> xyDataToQPointFList(PyObject *pyXIn, PyObject *pyYIn);
 
-/// Create a list of QPoint from 2 equally sized numpy array of x and y data
-/// (int).
+/// Fill a list of QPointF from 2 numpy vectors of x and y data, reusing
+/// its storage (for repeatedly converting data of similar sizes).
+/// \param pyXIn X data array
+/// \param pyYIn Y data array
+/// \param points Resulting list of QPointF, cleared on failure
+/// \return Whether the data could be converted
+
+PYSIDE_API bool xyDataToQPointFList(PyObject *pyXIn, PyObject *pyYIn,
+                                    QList<QPointF> *points);
+
+/// Create a list of QPoint from 2 numpy vectors of x and y data
+/// (floating point values are rounded).
 /// \param pyXIn X data array
 /// \param pyYIn Y data array
 /// \return List of QPoint
@@ -52,9 +52,15 @@ struct TypeUserData
 {
     explicit TypeUserData(PyTypeObject* type,  const QMetaObject* metaobject, std::size_t size) :
         mo(type, metaobject), cppObjSize(size) {}
+    ~TypeUserData() { Py_XDECREF(hiddenSignals); }
 
     MetaObjectBuilder mo;
     std::size_t cppObjSize;
+    // List of (name, signal) tuples of signals which are hidden by homonymous
+    // attributes and need to be bound when constructing instances, computed
+    // on first use by PySide::Signal::updateSourceObject() and cleared when
+    // an attribute of the type or a base is set.
+    PyObject *hiddenSignals = nullptr;
 };
 
 TypeUserData *retrieveTypeUserData(PyTypeObject *pyTypeObj);
@@ -62,6 +68,13 @@ TypeUserData *retrieveTypeUserData(PyObject *pyObj);
 // For QML
 PYSIDE_API const QMetaObject *retrieveMetaObject(PyTypeObject *pyTypeObj);
 PYSIDE_API const QMetaObject *retrieveMetaObject(PyObject *pyObj);
+// For QML type registration: Returns the meta object of a type and keeps it
+// and its successors alive, see MetaObjectBuilder::retainMetaObject()
+PYSIDE_API const QMetaObject *retainMetaObject(PyTypeObject *pyTypeObj);
+
+// Drop the types cached for QObjects returned from C++ having the meta object,
+// or all of them when a new type is bound
+void invalidateQObjectTypeCache(const QMetaObject *metaObject = nullptr);
 
 } //namespace PySide
 
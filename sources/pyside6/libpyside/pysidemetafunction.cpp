@@ -39,11 +39,20 @@
 
 #include "pysidemetafunction.h"
 #include "pysidemetafunction_p.h"
+#include "dynamicqmetaobject_p.h"
 
 #include <shiboken.h>
 #include <signature.h>
 
+#include <QtCore/QHash>
 #include <QtCore/QMetaMethod>
+#include <QtCore/QPair>
+#include <QtCore/QVarLengthArray>
+
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <vector>
 
 extern "C"
 {
@@ -130,98 +139,155 @@ PySideMetaFunction *newObject(QObject *source, int methodIndex)
     return nullptr;
 }
 
-bool call(QObject *self, int methodIndex, PyObject *args, PyObject **retVal)
+// Resolved type information of a parameter or of the return value of a meta
+// method. The converter is not set for a void return value.
+struct CallArgument
 {
+    QMetaType metaType;
+    std::optional<Shiboken::Conversions::SpecificConverter> converter;
+    bool isObjectType = false;
+};
+
+using CallArguments = std::vector<CallArgument>;
+using CallArgumentsPtr = std::shared_ptr<const CallArguments>;
+
+// Cache of the resolved arguments per meta object and absolute method index,
+// sparing the type name based lookups of converters and meta types per call.
+// Entries are shared since converting the arguments may run Python code
+// which modifies the cache.
+static QHash<const QMetaObject *, QHash<int, CallArgumentsPtr>> callArgumentsCache;
 
-    QMetaMethod method = self->metaObject()->method(methodIndex);
-    QList<QByteArray> argTypes = method.parameterTypes();
+// Arguments passed on the stack when calling meta methods with up to 8 parameters
+static constexpr qsizetype stackArguments = 9;
+
+static bool resolveCallArgument(const QByteArray &typeName, CallArguments *arguments)
+{
+    Shiboken::Conversions::SpecificConverter converter(typeName.constData());
+    if (!converter) {
+        PyErr_Format(PyExc_TypeError, "Unknown type used to call meta function (that may be a signal): %s",
+                     typeName.constData());
+        return false;
+    }
+    QMetaType metaType = QMetaType::fromName(typeName);
+    const bool isObjectType = Shiboken::Conversions::pythonTypeIsObjectType(converter);
+    if (!isObjectType && !metaType.isValid()) {
+        PyErr_Format(PyExc_TypeError, "Value types used on meta functions (including signals) need to be "
+                                      "registered on meta type: %s", typeName.constData());
+        return false;
+    }
+    arguments->push_back({metaType, converter, isObjectType});
+    return true;
+}
+
+// Returns the resolved return value (first entry) and parameters of a method.
+// Failures are not cached since the missing types might be registered later on.
+static CallArgumentsPtr callArguments(const QMetaObject *metaObject, const QMetaMethod &method)
+{
+    const int key = method.methodIndex();
+    auto metaObjectIt = callArgumentsCache.constFind(metaObject);
+    if (metaObjectIt != callArgumentsCache.cend()) {
+        auto it = metaObjectIt.value().constFind(key);
+        if (it != metaObjectIt.value().cend())
+            return it.value();
+    }
+
+    CallArguments arguments;
+    arguments.reserve(method.parameterCount() + 1);
+    const char *returnType = method.typeName();
+    if (returnType && std::strcmp("void", returnType)) {
+        if (!resolveCallArgument(returnType, &arguments))
+            return nullptr;
+    } else {
+        arguments.push_back({});
+    }
+    const QList<QByteArray> argTypes = method.parameterTypes();
+    for (const auto &typeName : argTypes) {
+        if (!resolveCallArgument(typeName, &arguments))
+            return nullptr;
+    }
+    auto result = std::make_shared<const CallArguments>(std::move(arguments));
+    callArgumentsCache[metaObject].insert(key, result);
+    return result;
+}
+
+void invalidateCache(const QMetaObject *metaObject)
+{
+    callArgumentsCache.remove(metaObject);
+}
+
+bool call(QObject *self, int methodIndex, PyObject *args, PyObject **retVal)
+{
+    MetaCallGuard metaCallGuard;
+    const QMetaObject *metaObject = self->metaObject();
+    QMetaMethod method = metaObject->method(methodIndex);
 
     // args given plus return type
     Shiboken::AutoDecRef sequence(PySequence_Fast(args, nullptr));
-    int numArgs = PySequence_Fast_GET_SIZE(sequence.object()) + 1;
+    const qsizetype numArgs = PySequence_Fast_GET_SIZE(sequence.object()) + 1;
+    const int parameterCount = method.parameterCount();
 
-    if (numArgs - 1 > argTypes.count()) {
+    if (numArgs - 1 > parameterCount) {
         PyErr_Format(PyExc_TypeError, "%s only accepts %d argument(s), %d given!",
                      method.methodSignature().constData(),
-                     argTypes.count(), numArgs - 1);
+                     parameterCount, int(numArgs - 1));
         return false;
     }
 
-    if (numArgs - 1 < argTypes.count()) {
+    if (numArgs - 1 < parameterCount) {
         PyErr_Format(PyExc_TypeError, "%s needs %d argument(s), %d given!",
                      method.methodSignature().constData(),
-                     argTypes.count(), numArgs - 1);
+                     parameterCount, int(numArgs - 1));
         return false;
     }
 
-    QVariant *methValues = new QVariant[numArgs];
-    void **methArgs = new void *[numArgs];
+    const CallArgumentsPtr arguments = callArguments(metaObject, method);
+    if (!arguments)
+        return false;
+
+    QVarLengthArray<QVariant, stackArguments> methValues(numArgs);
+    QVarLengthArray<void *, stackArguments> methArgs(numArgs);
 
-    // Prepare room for return type
-    const char *returnType = method.typeName();
-    if (returnType && std::strcmp("void", returnType))
-        argTypes.prepend(returnType);
-    else
-        argTypes.prepend(QByteArray());
-
-    int i = 0;
-    for (; i < numArgs; ++i) {
-        const QByteArray &typeName = argTypes.at(i);
+    for (qsizetype i = 0; i < numArgs; ++i) {
+        const CallArgument &argument = arguments->at(i);
         // This must happen only when the method hasn't return type.
-        if (typeName.isEmpty()) {
+        if (!argument.converter.has_value()) {
             methArgs[i] = nullptr;
             continue;
         }
 
-        Shiboken::Conversions::SpecificConverter converter(typeName);
-        if (converter) {
-            QMetaType metaType = QMetaType::fromName(typeName);
-            if (!Shiboken::Conversions::pythonTypeIsObjectType(converter)) {
-                if (!metaType.isValid()) {
-                    PyErr_Format(PyExc_TypeError, "Value types used on meta functions (including signals) need to be "
-                                                  "registered on meta type: %s", typeName.data());
-                    break;
-                }
-                methValues[i] = QVariant(metaType);
-            }
+        if (!argument.isObjectType)
+            methValues[i] = QVariant(argument.metaType);
+        methArgs[i] = methValues[i].data();
+        if (i == 0) // Don't do this for return type
+            continue;
+        auto converter = argument.converter.value();
+        PyObject *pyArg = PySequence_Fast_GET_ITEM(sequence.object(), i - 1);
+        if (argument.metaType.id() == QMetaType::QString) {
+            QString tmp;
+            converter.toCpp(pyArg, &tmp);
+            methValues[i] = tmp;
             methArgs[i] = methValues[i].data();
-            if (i == 0) // Don't do this for return type
-                continue;
-            if (metaType.id() == QMetaType::QString) {
-                QString tmp;
-                converter.toCpp(PySequence_Fast_GET_ITEM(sequence.object(), i - 1), &tmp);
-                methValues[i] = tmp;
-            } else {
-                converter.toCpp(PySequence_Fast_GET_ITEM(sequence.object(), i - 1), methArgs[i]);
-            }
         } else {
-            PyErr_Format(PyExc_TypeError, "Unknown type used to call meta function (that may be a signal): %s", argTypes[i].constData());
-            break;
+            converter.toCpp(pyArg, methArgs[i]);
         }
     }
 
-    bool ok = i == numArgs;
-    if (ok) {
-        Py_BEGIN_ALLOW_THREADS
-        QMetaObject::metacall(self, QMetaObject::InvokeMetaMethod, method.methodIndex(), methArgs);
-        Py_END_ALLOW_THREADS
-
-        if (retVal) {
-            if (methArgs[0]) {
-                static SbkConverter *qVariantTypeConverter = Shiboken::Conversions::getConverter("QVariant");
-                Q_ASSERT(qVariantTypeConverter);
-                *retVal = Shiboken::Conversions::copyToPython(qVariantTypeConverter, &methValues[0]);
-            } else {
-                *retVal = Py_None;
-                Py_INCREF(*retVal);
-            }
+    Py_BEGIN_ALLOW_THREADS
+    QMetaObject::metacall(self, QMetaObject::InvokeMetaMethod, method.methodIndex(), methArgs.data());
+    Py_END_ALLOW_THREADS
+
+    if (retVal) {
+        if (methArgs[0]) {
+            static SbkConverter *qVariantTypeConverter = Shiboken::Conversions::getConverter("QVariant");
+            Q_ASSERT(qVariantTypeConverter);
+            *retVal = Shiboken::Conversions::copyToPython(qVariantTypeConverter, &methValues[0]);
+        } else {
+            *retVal = Py_None;
+            Py_INCREF(*retVal);
         }
     }
 
-    delete[] methArgs;
-    delete[] methValues;
-
-    return ok;
+    return true;
 }
 
 } //namespace PySide::MetaFunction
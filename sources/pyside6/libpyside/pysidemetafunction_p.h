@@ -46,6 +46,7 @@
 
 QT_BEGIN_NAMESPACE
 class QObject;
+struct QMetaObject;
 QT_END_NAMESPACE
 
 namespace PySide { namespace MetaFunction {
@@ -56,6 +57,12 @@ namespace PySide { namespace MetaFunction {
      */
     bool call(QObject *self, int methodIndex, PyObject *args, PyObject **retVal = nullptr);
 
+    /**
+     * Discards the argument types cached for the methods of a meta object
+     * which is about to be deleted
+     */
+    void invalidateCache(const QMetaObject *metaObject);
+
 } //namespace MetaFunction
 } //namespace PySide
 
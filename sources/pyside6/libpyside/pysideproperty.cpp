@@ -124,7 +124,11 @@ PyTypeObject *PySidePropertyTypeF(void)
 
 static void qpropertyMetaCall(PySideProperty *pp, PyObject *self, QMetaObject::Call call, void **args)
 {
-    Shiboken::Conversions::SpecificConverter converter(pp->d->typeName);
+    // Avoid looking up the converter by type name on each read or write.
+    auto &cachedConverter = pp->d->converter;
+    if (!cachedConverter.has_value() || !cachedConverter.value())
+        cachedConverter.emplace(pp->d->typeName.constData());
+    auto &converter = cachedConverter.value();
     Q_ASSERT(converter);
 
     switch(call) {
@@ -610,6 +614,7 @@ void setMetaCallHandler(PySideProperty *self, MetaCallHandler handler)
 void setTypeName(PySideProperty *self, const char *typeName)
 {
     self->d->typeName = typeName;
+    self->d->converter.reset();
 }
 
 void setUserData(PySideProperty *self, void *data)
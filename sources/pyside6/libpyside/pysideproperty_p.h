@@ -41,15 +41,20 @@
 #define PYSIDE_QPROPERTY_P_H
 
 #include <sbkpython.h>
+#include <sbkconverter.h>
 #include <QtCore/QByteArray>
 #include <QMetaObject>
 #include "pysideproperty.h"
 
+#include <optional>
+
 struct PySideProperty;
 
 struct PySidePropertyPrivate
 {
     QByteArray typeName;
+    // Converter for typeName, resolved on the first meta call
+    std::optional<Shiboken::Conversions::SpecificConverter> converter;
     PySide::Property::MetaCallHandler metaCallHandler = nullptr;
     PyObject *fget = nullptr;
     PyObject *fset = nullptr;
@@ -92,6 +92,12 @@ PYSIDE_API void setNextQObjectMemoryAddr(void *addr);
 
 PYSIDE_API PyObject *getWrapperForQObject(QObject *cppSelf, PyTypeObject *sbk_type);
 
+/// Keep a meta object built by PySide alive for the lifetime of a wrapper
+/// referencing it even if it is superseded (QMetaObject, QMetaMethod, etc.)
+/// \param pyObj wrapper
+/// \param metaObject meta object referenced by \p pyObj
+PYSIDE_API void keepMetaObjectAlive(PyObject *pyObj, const QMetaObject *metaObject);
+
 /// Return the best-matching type for a QObject (Helper for QObject.findType())
 /// \param cppSelf QObject instance
 /// \return type object
@@ -0,0 +1,347 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "pysideqslotobject_p.h"
+#include "pysidesignal.h"
+#include "pysidestaticstrings.h"
+#include "pysideweakref.h"
+
+#include <autodecref.h>
+#include <gilstate.h>
+#include <sbkconverter.h>
+
+#include <QtCore/QMultiHash>
+#include <QtCore/QObject>
+#include <QtCore/qhashfunctions.h>
+#include <private/qobject_p.h>
+
+#include <vector>
+
+namespace PySide
+{
+
+// Identifies a callable. Bound methods are identified by instance and
+// function since a new method object is created on each attribute access.
+struct CallbackKey
+{
+    const PyObject *object;
+    const PyObject *method;
+};
+
+static inline bool operator==(const CallbackKey &k1, const CallbackKey &k2)
+{
+    return k1.object == k2.object && k1.method == k2.method;
+}
+
+static CallbackKey callbackKey(PyObject *callback)
+{
+    if (PyMethod_Check(callback)) {
+        // PYSIDE-1422: Avoid hash on self which might be unhashable.
+        return {PyMethod_GET_SELF(callback), PyMethod_GET_FUNCTION(callback)};
+    }
+    if (PyObject_HasAttr(callback, PySide::PyName::im_func())
+        && PyObject_HasAttr(callback, PySide::PyName::im_self())) {
+        // PYSIDE-1589: Fix for slots in compiled functions
+        Shiboken::AutoDecRef self(PyObject_GetAttr(callback, PySide::PyName::im_self()));
+        Shiboken::AutoDecRef func(PyObject_GetAttr(callback, PySide::PyName::im_func()));
+        return {self, func};
+    }
+    return {nullptr, callback};
+}
+
+struct SlotObjectKey
+{
+    const QObject *source;
+    int signalIndex;
+    CallbackKey callback;
+};
+
+static inline bool operator==(const SlotObjectKey &k1, const SlotObjectKey &k2)
+{
+    return k1.source == k2.source && k1.signalIndex == k2.signalIndex
+        && k1.callback == k2.callback;
+}
+
+static size_t qHash(const SlotObjectKey &k, size_t seed = 0)
+{
+    QtPrivate::QHashCombine hash;
+    seed = hash(seed, k.source);
+    seed = hash(seed, k.signalIndex);
+    seed = hash(seed, k.callback.object);
+    seed = hash(seed, k.callback.method);
+    return seed;
+}
+
+/**
+ * A functor connection calling a Python callable with the arguments of a
+ * signal. It is owned by the connection and deleted by Qt when the connection
+ * is removed.
+ **/
+class PySideQSlotObject : public QtPrivate::QSlotObjectBase
+{
+    Q_DISABLE_COPY_MOVE(PySideQSlotObject)
+public:
+    PySideQSlotObject(const SlotObjectKey &key, PyObject *callback,
+                      const QList<QByteArray> &parameterTypes, bool isShortCircuit);
+
+    const SlotObjectKey &key() const { return m_key; }
+    const QMetaObject::Connection &connection() const { return m_connection; }
+    void setConnection(const QMetaObject::Connection &c) { m_connection = c; }
+
+private:
+    ~PySideQSlotObject();
+
+    static void impl(int which, QSlotObjectBase *this_, QObject *receiver, void **args, bool *ret);
+    static void onCallbackDestroyed(void *data);
+
+    PyObject *callback() const;
+    PyObject *convertArguments(void **args);
+    void call(void **args);
+
+    const SlotObjectKey m_key;
+    QMetaObject::Connection m_connection;
+    PyObject *m_callback = nullptr;
+    PyObject *m_pythonSelf = nullptr;
+    PyObject *m_weakRef = nullptr;
+    const QList<QByteArray> m_parameterTypes;
+    std::vector<Shiboken::Conversions::SpecificConverter> m_converters;
+    bool m_isMethod = false;
+    const bool m_isShortCircuit;
+};
+
+// All slot objects by sender, signal and callback for disconnecting them.
+// Accessed with the GIL held only.
+static QMultiHash<SlotObjectKey, PySideQSlotObject *> slotObjects;
+
+PySideQSlotObject::PySideQSlotObject(const SlotObjectKey &key, PyObject *callback,
+                                     const QList<QByteArray> &parameterTypes,
+                                     bool isShortCircuit) :
+    QSlotObjectBase(&PySideQSlotObject::impl),
+    m_key(key),
+    m_parameterTypes(parameterTypes),
+    m_isShortCircuit(isShortCircuit)
+{
+    if (PyMethod_Check(callback)) {
+        m_isMethod = true;
+        // To avoid increment instance reference keep the callback information
+        m_callback = PyMethod_GET_FUNCTION(callback);
+        Py_INCREF(m_callback);
+        m_pythonSelf = PyMethod_GET_SELF(callback);
+    } else if (PyObject_HasAttr(callback, PySide::PyName::im_func())
+               && PyObject_HasAttr(callback, PySide::PyName::im_self())) {
+        // PYSIDE-1523: PyMethod_Check is not accepting compiled form, we just go by attributes.
+        m_isMethod = true;
+        m_callback = PyObject_GetAttr(callback, PySide::PyName::im_func());
+        m_pythonSelf = PyObject_GetAttr(callback, PySide::PyName::im_self());
+        Py_DECREF(m_pythonSelf);
+    } else {
+        m_callback = callback;
+        Py_INCREF(m_callback);
+    }
+
+    // Remove the connection along with the instance of a bound method
+    if (m_isMethod)
+        m_weakRef = WeakRef::create(m_pythonSelf, PySideQSlotObject::onCallbackDestroyed, this);
+
+    m_converters.reserve(m_parameterTypes.size());
+    for (const auto &parameterType : m_parameterTypes)
+        m_converters.emplace_back(parameterType.constData());
+}
+
+PySideQSlotObject::~PySideQSlotObject()
+{
+    Shiboken::GilState gil;
+    slotObjects.remove(m_key, this);
+    Py_XDECREF(m_weakRef);
+    Py_DECREF(m_callback);
+}
+
+void PySideQSlotObject::impl(int which, QSlotObjectBase *this_, QObject *, void **args, bool *ret)
+{
+    auto self = static_cast<PySideQSlotObject *>(this_);
+    switch (which) {
+    case Destroy:
+        delete self;
+        break;
+    case Call:
+        self->call(args);
+        break;
+    case Compare: // Used for pointers to member functions only
+        *ret = false;
+        break;
+    case NumOperations:
+        break;
+    }
+}
+
+void PySideQSlotObject::onCallbackDestroyed(void *data)
+{
+    auto self = reinterpret_cast<PySideQSlotObject *>(data);
+    self->m_weakRef = nullptr;
+    // Deletes the slot object unless it is currently being called.
+    const QMetaObject::Connection connection = self->m_connection;
+    Py_BEGIN_ALLOW_THREADS
+    QObject::disconnect(connection);
+    Py_END_ALLOW_THREADS
+}
+
+PyObject *PySideQSlotObject::callback() const
+{
+    if (m_isMethod)
+        return Py_TYPE(m_callback)->tp_descr_get(m_callback, m_pythonSelf, nullptr);
+    Py_INCREF(m_callback);
+    return m_callback;
+}
+
+PyObject *PySideQSlotObject::convertArguments(void **args)
+{
+    const auto argsSize = Py_ssize_t(m_converters.size());
+    PyObject *preparedArgs = PyTuple_New(argsSize);
+    for (Py_ssize_t i = 0; i < argsSize; ++i) {
+        auto &converter = m_converters[i];
+        if (!converter) {
+            PyErr_Format(PyExc_TypeError, "Can't call meta function because I have no idea how to handle %s",
+                         m_parameterTypes.at(i).constData());
+            Py_DECREF(preparedArgs);
+            return nullptr;
+        }
+        PyTuple_SET_ITEM(preparedArgs, i, converter.toPython(args[i + 1]));
+    }
+    return preparedArgs;
+}
+
+void PySideQSlotObject::call(void **args)
+{
+    Shiboken::GilState gil;
+    Shiboken::AutoDecRef pyCallback(callback());
+    if (!pyCallback.isNull()) {
+        PyObject *pyArguments = m_isShortCircuit
+            ? reinterpret_cast<PyObject *>(args[1]) : convertArguments(args);
+        if (pyArguments) {
+            Shiboken::AutoDecRef retval(PyObject_CallObject(pyCallback, pyArguments));
+            if (!m_isShortCircuit)
+                Py_DECREF(pyArguments);
+        }
+    }
+
+    // Print the error so it is considered "handled".
+    if (PyErr_Occurred()) {
+        int reclimit = Py_GetRecursionLimit();
+        if (reclimit < (1 << 30))
+            Py_SetRecursionLimit(reclimit + 5);
+        PyErr_Print();
+        Py_SetRecursionLimit(reclimit);
+    }
+}
+
+// Context of connections to callables which are not bound to a QObject. The
+// callable is invoked in the thread the connection was made from.
+static const QObject *threadContext()
+{
+    // Leaked: Destroying it at thread or process exit would delete the slot
+    // objects, which requires the GIL, possibly after Python finalization.
+    static thread_local auto *context = new QObject;
+    return context;
+}
+
+namespace SlotObject
+{
+
+QMetaObject::Connection connect(QObject *source, int signalIndex,
+                                const QByteArray &callbackSig, PyObject *callback,
+                                const QObject *context, Qt::ConnectionType type)
+{
+    const SlotObjectKey key{source, signalIndex, callbackKey(callback)};
+    // QObjectPrivate::connect() cannot compare slot objects.
+    if ((type & Qt::UniqueConnection) != 0) {
+        if (slotObjects.contains(key))
+            return {};
+        type = static_cast<Qt::ConnectionType>(type & ~Qt::UniqueConnection);
+    }
+
+    bool isShortCircuit = false;
+    const QStringList args = Signal::getArgsFromSignature(callbackSig.constData(),
+                                                          &isShortCircuit);
+    QList<QByteArray> parameterTypes;
+    if (!isShortCircuit) {
+        parameterTypes.reserve(args.size());
+        for (const auto &arg : args)
+            parameterTypes.append(arg.toLatin1());
+    }
+
+    auto slotObject = new PySideQSlotObject(key, callback, parameterTypes, isShortCircuit);
+    // The slot object is deleted by Qt when connecting fails.
+    auto connection = QObjectPrivate::connect(source, signalIndex,
+                                              context ? context : threadContext(),
+                                              slotObject, type);
+    if (connection) {
+        slotObject->setConnection(connection);
+        slotObjects.insert(key, slotObject);
+    }
+    return connection;
+}
+
+bool disconnect(QObject *source, int signalIndex, PyObject *callback)
+{
+    const SlotObjectKey key{source, signalIndex, callbackKey(callback)};
+    auto it = slotObjects.constFind(key);
+    if (it == slotObjects.cend())
+        return false;
+    const QMetaObject::Connection connection = it.value()->connection();
+    return QObject::disconnect(connection);
+}
+
+void disconnectAll()
+{
+    QList<QMetaObject::Connection> connections;
+    connections.reserve(slotObjects.size());
+    for (const auto *slotObject : qAsConst(slotObjects))
+        connections.append(slotObject->connection());
+    for (const auto &connection : qAsConst(connections))
+        QObject::disconnect(connection);
+}
+
+qsizetype connectionCount()
+{
+    return slotObjects.size();
+}
+
+} // namespace SlotObject
+} // namespace PySide
@@ -0,0 +1,95 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef PYSIDE_QSLOTOBJECT_P_H
+#define PYSIDE_QSLOTOBJECT_P_H
+
+#include <sbkpython.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QMetaObject>
+
+QT_FORWARD_DECLARE_CLASS(QObject)
+
+namespace PySide { namespace SlotObject {
+
+/**
+ * Connects a signal to a Python callable using a functor connection
+ * (QtPrivate::QSlotObjectBase).
+ *
+ * The connection is removed when the instance a bound method belongs to
+ * is destroyed.
+ *
+ * @param   source          The sender
+ * @param   signalIndex     The method index of the signal
+ * @param   callbackSig     The signature of the callback as returned by
+ *                          Signal::getCallbackSignature(), determining the
+ *                          arguments passed on
+ * @param   callback        The Python callable
+ * @param   context         The object in whose thread the callable is
+ *                          invoked, the current thread if nullptr
+ * @param   type            The connection type
+ * @return  The connection, which is invalid on failure
+ **/
+QMetaObject::Connection connect(QObject *source, int signalIndex,
+                                const QByteArray &callbackSig, PyObject *callback,
+                                const QObject *context, Qt::ConnectionType type);
+
+/**
+ * Removes one connection of a signal to a Python callable made by connect().
+ *
+ * @return  Whether a connection was removed
+ **/
+bool disconnect(QObject *source, int signalIndex, PyObject *callback);
+
+/**
+ * Removes all connections made by connect().
+ **/
+void disconnectAll();
+
+/**
+ * Returns the number of connections made by connect().
+ **/
+qsizetype connectionCount();
+
+} // namespace SlotObject
+} // namespace PySide
+
+#endif // PYSIDE_QSLOTOBJECT_P_H
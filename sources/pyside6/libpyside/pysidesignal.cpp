@@ -40,7 +40,10 @@
 #include <sbkpython.h>
 #include "pysidesignal.h"
 #include "pysidesignal_p.h"
+#include "dynamicqmetaobject_p.h"
 #include "pysidestaticstrings.h"
+#include "pyside_p.h"
+#include "pysideqobject.h"
 #include "signalmanager.h"
 
 #include <shiboken.h>
@@ -48,6 +51,7 @@
 #include <QtCore/QObject>
 #include <QtCore/QMetaMethod>
 #include <QtCore/QMetaObject>
+#include <QtCore/QVariant>
 #include <signature.h>
 
 #include <algorithm>
@@ -87,6 +91,8 @@ namespace Signal {
     static void instanceInitialize(PySideSignalInstance *, PyObject *, PySideSignal *, PyObject *, int);
     static QByteArray parseSignature(PyObject *);
     static PyObject *buildQtCompatible(const QByteArray &);
+    static PyObject *bindSignal(PySideSignal *, PyObject *);
+    static PyObject *emitFast(PySideSignalInstance *, PyObject *);
 }
 }
 
@@ -511,9 +517,7 @@ static PyObject *signalInstanceEmit(PyObject *self, PyObject *args)
 {
     PySideSignalInstance *source = reinterpret_cast<PySideSignalInstance *>(self);
 
-    Shiboken::AutoDecRef pyArgs(PyList_New(0));
     int numArgsGiven = PySequence_Fast_GET_SIZE(args);
-    int numArgsInSignature = argCountInSignature(source->d->signature);
 
     // If number of arguments given to emit is smaller than the first source signature expects,
     // it is possible it's a case of emitting a signal with default parameters.
@@ -523,7 +527,9 @@ static PyObject *signalInstanceEmit(PyObject *self, PyObject *args)
     // @TODO: This should be improved to take into account argument types as well. The current
     // assumption is there are no signals which are both overloaded on argument types and happen to
     // have signatures with default parameters.
-    if (numArgsGiven < numArgsInSignature) {
+    // Overloads are chained via "next", a single signal needs no signature parsing.
+    if (source->d->next != nullptr
+        && numArgsGiven < argCountInSignature(source->d->signature)) {
         PySideSignalInstance *possibleDefaultInstance = source;
         while ((possibleDefaultInstance = possibleDefaultInstance->d->next)) {
             if (possibleDefaultInstance->d->attributes & QMetaMethod::Cloned
@@ -533,6 +539,12 @@ static PyObject *signalInstanceEmit(PyObject *self, PyObject *args)
             }
         }
     }
+    if (PyObject *result = PySide::Signal::emitFast(source, args))
+        return result;
+    if (PyErr_Occurred())
+        return nullptr;
+
+    Shiboken::AutoDecRef pyArgs(PyList_New(0));
     Shiboken::AutoDecRef sourceSignature(PySide::Signal::buildQtCompatible(source->d->signature));
 
     PyList_Append(pyArgs, sourceSignature);
@@ -628,6 +640,15 @@ static PyObject *signalDescrGet(PyObject *self, PyObject *obj, PyObject * /*type
         Py_INCREF(self);
         return self;
     }
+    // Signals of objects created from Python are bound on first access and
+    // cached in the instance dictionary, see PySide::Signal::updateSourceObject().
+    if (Shiboken::Object::checkType(obj)
+        && Shiboken::Object::wasCreatedByPython(reinterpret_cast<SbkObject *>(obj))) {
+        if (PyObject *result = PySide::Signal::bindSignal(signal, obj))
+            return result;
+        if (PyErr_Occurred())
+            return nullptr;
+    }
     Shiboken::AutoDecRef name(Py_BuildValue("s", signal->data->signalName.data()));
     return reinterpret_cast<PyObject *>(PySide::Signal::initialize(signal, name, obj));
 }
@@ -745,6 +766,22 @@ static const char *SignalInstance_SignatureStrings[] = {
     "PySide6.QtCore.SignalInstance.emit(self,*args:typing.Any)",
     nullptr}; // Sentinel
 
+// PYSIDE-803: Setting an attribute of a type may hide or expose signals of
+// the type and its subclasses.
+static void clearHiddenSignals(PyTypeObject *type)
+{
+    if (TypeUserData *userData = retrieveTypeUserData(type))
+        Py_CLEAR(userData->hiddenSignals);
+    Shiboken::AutoDecRef subTypes(PyObject_CallMethod(reinterpret_cast<PyObject *>(type),
+                                                      "__subclasses__", nullptr));
+    if (subTypes.isNull()) {
+        PyErr_Clear();
+        return;
+    }
+    for (Py_ssize_t i = 0, n = PyList_Size(subTypes.object()); i < n; ++i)
+        clearHiddenSignals(reinterpret_cast<PyTypeObject *>(PyList_GetItem(subTypes.object(), i)));
+}
+
 void init(PyObject *module)
 {
     if (InitSignatureStrings(PySideMetaSignalTypeF(), MetaSignal_SignatureStrings) < 0)
@@ -761,6 +798,8 @@ void init(PyObject *module)
         return;
     Py_INCREF(PySideSignalInstanceTypeF());
     PyModule_AddObject(module, "SignalInstance", reinterpret_cast<PyObject *>(PySideSignalInstanceTypeF()));
+
+    setTypeSetAttrHook(clearHiddenSignals);
 }
 
 bool checkType(PyObject *pyObj)
@@ -776,40 +815,219 @@ bool checkInstanceType(PyObject *pyObj)
         && PyType_IsSubtype(Py_TYPE(pyObj), PySideSignalInstanceTypeF()) != 0;
 }
 
-void updateSourceObject(PyObject *source)
+// Resolve the signal index and the argument converters of a signal instance
+// for its source's current meta object.
+static bool resolveEmitData(PySideSignalInstancePrivate *d, const QMetaObject *metaObject)
 {
-    // TODO: Provide for actual upstream exception handling.
-    //       For now we'll just return early to avoid further issues.
+    d->emitMetaObject = nullptr;
+    d->emitReclaimedCount = PySide::reclaimedMetaObjectCount();
+    d->emitMetaTypes.clear();
+    d->emitConverters.clear();
+    d->emitSignalIndex = metaObject->indexOfSignal(d->signature.constData());
+    if (d->emitSignalIndex == -1)
+        return false;
 
-    if (source == nullptr)      // Bad input
-       return;
+    const auto parameterTypes = metaObject->method(d->emitSignalIndex).parameterTypes();
+    d->emitConverters.reserve(parameterTypes.size());
+    for (const auto &typeName : parameterTypes) {
+        Shiboken::Conversions::SpecificConverter converter(typeName.constData());
+        if (!converter)
+            return false;
+        QMetaType metaType = QMetaType::fromName(typeName);
+        if (!metaType.isValid() && !Shiboken::Conversions::pythonTypeIsObjectType(converter))
+            return false;
+        d->emitConverters.push_back(converter);
+        d->emitMetaTypes.append(metaType);
+    }
+    d->emitMetaObject = metaObject;
+    return true;
+}
 
-    Shiboken::AutoDecRef mroIterator(PyObject_GetIter(source->ob_type->tp_mro));
+// Emit a signal without going through QObject.emit() and the signature
+// string lookup of SignalManager::emitSignal(). The arguments are converted
+// into stack storage using converters cached in the signal instance.
+// Returns nullptr without an error set when the generic path has to be
+// taken (unresolvable signal or argument types, argument count mismatch,
+// deleted source).
+static PyObject *emitFast(PySideSignalInstance *source, PyObject *args)
+{
+    constexpr Py_ssize_t maxArgs = 8;
 
-    if (mroIterator.isNull())   // Not iterable
-       return;
+    PySideSignalInstancePrivate *d = source->d;
+    const Py_ssize_t argCount = PyTuple_GET_SIZE(args);
+    if (argCount > maxArgs || !Shiboken::Object::isValid(d->source, false))
+        return nullptr;
+    QObject *qobject = PySide::convertToQObject(d->source, false);
+    if (qobject == nullptr)
+        return nullptr;
+
+    // A freed meta object's address may be reused by a new one.
+    const QMetaObject *metaObject = qobject->metaObject();
+    if ((metaObject != d->emitMetaObject
+         || d->emitReclaimedCount != PySide::reclaimedMetaObjectCount())
+        && !resolveEmitData(d, metaObject)) {
+        return nullptr;
+    }
+    if (argCount != Py_ssize_t(d->emitConverters.size()))
+        return nullptr;
+
+    QVariant values[maxArgs];
+    void *signalArgs[maxArgs + 1] = {nullptr};
+    for (Py_ssize_t i = 0; i < argCount; ++i) {
+        const QMetaType &metaType = d->emitMetaTypes.at(i);
+        auto &converter = d->emitConverters[i];
+        PyObject *pyArg = PyTuple_GET_ITEM(args, i);
+        if (metaType.id() == QMetaType::QString) {
+            QString tmp;
+            converter.toCpp(pyArg, &tmp);
+            values[i] = tmp;
+        } else {
+            if (!Shiboken::Conversions::pythonTypeIsObjectType(converter))
+                values[i] = QVariant(metaType);
+            converter.toCpp(pyArg, values[i].data());
+        }
+        if (PyErr_Occurred())
+            return nullptr;
+        signalArgs[i + 1] = values[i].data();
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    QMetaObject::activate(qobject, d->emitSignalIndex, signalArgs);
+    Py_END_ALLOW_THREADS
 
-    Shiboken::AutoDecRef mroItem{};
+    Py_RETURN_TRUE;
+}
 
-    while ((mroItem.reset(PyIter_Next(mroIterator))), mroItem.object()) {
+// Return whether the signal is an attribute of type or its bases under name.
+static bool isSignalAttribute(PySideSignal *signal, PyTypeObject *type, PyObject *name)
+{
+    PyObject *mro = type->tp_mro;
+    for (Py_ssize_t i = 0, n = PyTuple_GET_SIZE(mro); i < n; ++i) {
+        auto *baseType = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, i));
+        if (PyDict_GetItem(baseType->tp_dict, name) == reinterpret_cast<PyObject *>(signal))
+            return true;
+    }
+    return false;
+}
+
+// Return the name of the class attribute holding the signal as a new reference,
+// looking it up in the MRO of type. The name found last is cached, but checked
+// against type since the signal may be aliased in several attributes or classes.
+static PyObject *signalAttributeName(PySideSignal *signal, PyTypeObject *type)
+{
+    QByteArray &attributeName = signal->data->attributeName;
+    if (!attributeName.isEmpty()) {
+        PyObject *name = Shiboken::String::fromCString(attributeName.constData());
+        if (isSignalAttribute(signal, type, name))
+            return name;
+        Py_DECREF(name);
+    }
+
+    PyObject *mro = type->tp_mro;
+    for (Py_ssize_t i = 0, n = PyTuple_GET_SIZE(mro); i < n; ++i) {
+        auto *baseType = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, i));
         Py_ssize_t pos = 0;
         PyObject *key, *value;
-        auto *type = reinterpret_cast<PyTypeObject *>(mroItem.object());
-
-        while (PyDict_Next(type->tp_dict, &pos, &key, &value)) {
-            if (PyObject_TypeCheck(value, PySideSignalTypeF())) {
-                auto *inst = PyObject_New(PySideSignalInstance, PySideSignalInstanceTypeF());
-                Shiboken::AutoDecRef signalInstance(reinterpret_cast<PyObject *>(inst));
-                instanceInitialize(signalInstance.cast<PySideSignalInstance *>(),
-                                   key, reinterpret_cast<PySideSignal *>(value), source, 0);
-                if (PyObject_SetAttr(source, key, signalInstance) == -1)
-                    return;     // An error occurred while setting the attribute
+        while (PyDict_Next(baseType->tp_dict, &pos, &key, &value)) {
+            if (value == reinterpret_cast<PyObject *>(signal)) {
+                attributeName = Shiboken::String::toCString(key);
+                Py_INCREF(key);
+                return key;
             }
         }
     }
+    return nullptr;
+}
+
+// Create the signal instance of an object created from Python and store it in
+// the instance dictionary, which takes precedence over the (non-data) descriptor
+// for subsequent accesses. Returns a new reference or nullptr if the signal is
+// not an attribute of the class or the name is taken by another instance attribute.
+static PyObject *bindSignal(PySideSignal *signal, PyObject *source)
+{
+    static PyTypeObject *pyQObjectType = Shiboken::Conversions::getPythonTypeObject("QObject*");
+    if (!PyObject_TypeCheck(source, pyQObjectType))
+        return nullptr;
+
+    Shiboken::AutoDecRef name(signalAttributeName(signal, Py_TYPE(source)));
+    if (name.isNull())
+        return nullptr;
+
+    PyObject *dict = SbkObject_GetDict(source);
+    if (PyObject *existing = PyDict_GetItem(dict, name)) {
+        if (!checkInstanceType(existing))
+            return nullptr;
+        Py_INCREF(existing);
+        return existing;
+    }
 
-    if (PyErr_Occurred())       // An iteration error occurred
+    auto *inst = PyObject_New(PySideSignalInstance, PySideSignalInstanceTypeF());
+    instanceInitialize(inst, name, signal, source, 0);
+    auto *result = reinterpret_cast<PyObject *>(inst);
+    if (PyDict_SetItem(dict, name, result) == -1) {
+        Py_DECREF(result);
+        return nullptr;
+    }
+    return result;
+}
+
+// Return a list of (name, signal) tuples of the signals that eager binding
+// used to set on instances although they are hidden by a homonymous attribute
+// found earlier in the MRO (PYSIDE-1730), or by another signal of the same
+// name further down in the MRO, which eager binding gave precedence to.
+static PyObject *collectHiddenSignals(PyTypeObject *type)
+{
+    Shiboken::AutoDecRef firstAttributes(PyDict_New());
+    Shiboken::AutoDecRef lastSignals(PyDict_New());
+
+    PyObject *mro = type->tp_mro;
+    for (Py_ssize_t i = 0, n = PyTuple_GET_SIZE(mro); i < n; ++i) {
+        auto *baseType = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, i));
+        Py_ssize_t pos = 0;
+        PyObject *key, *value;
+        while (PyDict_Next(baseType->tp_dict, &pos, &key, &value)) {
+            if (PyDict_GetItem(firstAttributes, key) == nullptr)
+                PyDict_SetItem(firstAttributes, key, value);
+            if (PyObject_TypeCheck(value, PySideSignalTypeF()))
+                PyDict_SetItem(lastSignals, key, value);
+        }
+    }
+
+    PyObject *result = PyList_New(0);
+    Py_ssize_t pos = 0;
+    PyObject *key, *value;
+    while (PyDict_Next(lastSignals, &pos, &key, &value)) {
+        if (PyDict_GetItem(firstAttributes, key) != value) {
+            Shiboken::AutoDecRef item(PyTuple_Pack(2, key, value));
+            PyList_Append(result, item);
+        }
+    }
+    return result;
+}
+
+void updateSourceObject(PyObject *source)
+{
+    // Signal instances are normally created on first access by signalDescrGet().
+    // Only the signals that would not be found that way are bound here.
+    if (source == nullptr)      // Bad input
+       return;
+
+    TypeUserData *userData = retrieveTypeUserData(source);
+    if (userData == nullptr)
         return;
+    if (userData->hiddenSignals == nullptr)
+        userData->hiddenSignals = collectHiddenSignals(Py_TYPE(source));
+
+    for (Py_ssize_t i = 0, n = PyList_GET_SIZE(userData->hiddenSignals); i < n; ++i) {
+        PyObject *item = PyList_GET_ITEM(userData->hiddenSignals, i);
+        PyObject *key = PyTuple_GET_ITEM(item, 0);
+        auto *signal = reinterpret_cast<PySideSignal *>(PyTuple_GET_ITEM(item, 1));
+        auto *inst = PyObject_New(PySideSignalInstance, PySideSignalInstanceTypeF());
+        Shiboken::AutoDecRef signalInstance(reinterpret_cast<PyObject *>(inst));
+        instanceInitialize(inst, key, signal, source, 0);
+        if (PyObject_SetAttr(source, key, signalInstance) == -1)
+            return;     // An error occurred while setting the attribute
+    }
 }
 
 QByteArray getTypeName(PyObject *obType)
@@ -992,6 +1210,7 @@ static void _addSignalToWrapper(PyTypeObject *wrapperType, const char *signalNam
         Py_INCREF(homonymousMethod);
         signal->homonymousMethod = homonymousMethod;
     }
+    signal->data->attributeName = signalName;
     PyDict_SetItemString(typeDict, signalName, reinterpret_cast<PyObject *>(signal));
 }
 
@@ -129,10 +129,11 @@ PYSIDE_API PyObject *getObject(PySideSignalInstance *signal);
 PYSIDE_API const char *getSignature(PySideSignalInstance *signal);
 
 /**
- * This function is used to retrieve the signal signature
+ * This function binds the signals of a newly constructed object which can not
+ * be bound lazily on first attribute access since they are hidden by
+ * homonymous attributes of the type.
  *
- * @param   self The Signal object
- * @return  Return the signal signature
+ * @param   source The newly constructed object
  **/
 PYSIDE_API void updateSourceObject(PyObject *source);
 
@@ -41,9 +41,13 @@
 #define PYSIDE_QSIGNAL_P_H
 
 #include <sbkpython.h>
+#include <sbkconverter.h>
 
 #include <QtCore/QByteArray>
 #include <QtCore/QList>
+#include <QtCore/QMetaType>
+
+#include <vector>
 
 struct PySideSignalData
 {
@@ -56,6 +60,9 @@ struct PySideSignalData
     QByteArray signalName;
     QList<Signature> signatures;
     QByteArrayList *signalArguments;
+    // Name of the class attribute last found holding the signal when binding
+    // it to an instance (see signalDescrGet()).
+    QByteArray attributeName;
 };
 
 extern "C"
@@ -79,6 +86,15 @@ struct PySideSignalInstancePrivate
     PyObject *source = nullptr;
     PyObject *homonymousMethod = nullptr;
     PySideSignalInstance *next = nullptr;
+
+    // Resolved on first emission for the fast emit path (see signalInstanceEmit()),
+    // valid as long as the source returns the same meta object and no meta
+    // object has been freed meanwhile.
+    const QMetaObject *emitMetaObject = nullptr;
+    quint64 emitReclaimedCount = 0;
+    int emitSignalIndex = -1;
+    QList<QMetaType> emitMetaTypes;
+    std::vector<Shiboken::Conversions::SpecificConverter> emitConverters;
 };
 
 namespace PySide { namespace Signal {
@@ -47,6 +47,8 @@
 #include <QtCore/QtGlobal>
 
 QT_FORWARD_DECLARE_CLASS(QString)
+QT_FORWARD_DECLARE_CLASS(QStringView)
+QT_FORWARD_DECLARE_CLASS(QAnyStringView)
 
 namespace PySide
 {
@@ -63,6 +65,17 @@ PYSIDE_API QString pyStringToQString(PyObject *str);
 /// Provide an efficient, correct PathLike interface.
 PYSIDE_API QString pyPathToQString(PyObject *path);
 
+/// Convert UTF-16 data to a Python string in one pass, writing it directly
+/// into a string of the narrowest kind. Lone surrogates are replaced.
+/// \param s String
+/// \return New reference to a Python string
+PYSIDE_API PyObject *qStringToPyUnicode(QStringView s);
+
+/// Convert a string view of any encoding to a Python string.
+/// \param s String
+/// \return New reference to a Python string
+PYSIDE_API PyObject *qAnyStringToPyUnicode(QAnyStringView s);
+
 } //namespace PySide
 
 #endif // PYSIDESTRING_H
@@ -39,6 +39,7 @@
 
 #include "qobjectconnect.h"
 #include "pysideqobject.h"
+#include "pysideqslotobject_p.h"
 #include "pysidesignal.h"
 #include "signalmanager.h"
 
@@ -85,7 +86,7 @@ struct GetReceiverResult
     QObject *receiver = nullptr;
     PyObject *self = nullptr;
     QByteArray callbackSig;
-    bool usingGlobalReceiver = false;
+    bool usingSlotObject = false;
     int slotIndex = -1;
 };
 
@@ -97,7 +98,7 @@ QDebug operator<<(QDebug d, const GetReceiverResult &r)
     d.nospace();
     d << "GetReceiverResult(receiver=" << r.receiver << ", self=" << r.self
       << ", sig=" << r.callbackSig << "slotIndex=" << r.slotIndex
-      << ", usingGlobalReceiver=" << r.usingGlobalReceiver << ')';
+      << ", usingSlotObject=" << r.usingSlotObject << ')';
     return d;
 }
 #endif // QT_NO_DEBUG_STREAM
@@ -107,11 +108,11 @@ static GetReceiverResult getReceiver(QObject *source, const char *signal,
 {
     GetReceiverResult result;
 
-    bool forceGlobalReceiver = false;
+    bool forceSlotObject = false;
     if (PyMethod_Check(callback)) {
         result.self = PyMethod_GET_SELF(callback);
         result.receiver = PySide::convertToQObject(result.self, false);
-        forceGlobalReceiver = isMethodDecorator(callback, true, result.self);
+        forceSlotObject = isMethodDecorator(callback, true, result.self);
     } else if (PyCFunction_Check(callback)) {
         result.self = PyCFunction_GET_SELF(callback);
         result.receiver = PySide::convertToQObject(result.self, false);
@@ -120,42 +121,35 @@ static GetReceiverResult getReceiver(QObject *source, const char *signal,
         result.self = PyObject_GetAttr(callback, Shiboken::PyName::im_self());
         Py_DECREF(result.self);
         result.receiver = PySide::convertToQObject(result.self, false);
-        forceGlobalReceiver = isMethodDecorator(callback, false, result.self);
+        forceSlotObject = isMethodDecorator(callback, false, result.self);
     } else if (PyCallable_Check(callback)) {
         // Ok, just a callable object
         result.receiver = nullptr;
         result.self = nullptr;
     }
 
-    result.usingGlobalReceiver = !result.receiver || forceGlobalReceiver;
+    result.usingSlotObject = !result.receiver || forceSlotObject;
 
     // Check if this callback is a overwrite of a non-virtual Qt slot.
-    if (!result.usingGlobalReceiver && result.receiver && result.self) {
+    if (!result.usingSlotObject && result.receiver && result.self) {
         result.callbackSig =
             PySide::Signal::getCallbackSignature(signal, result.receiver, callback,
-                                                 result.usingGlobalReceiver).toLatin1();
+                                                 result.usingSlotObject).toLatin1();
         const QMetaObject *metaObject = result.receiver->metaObject();
         result.slotIndex = metaObject->indexOfSlot(result.callbackSig.constData());
         if (result.slotIndex != -1 && result.slotIndex < metaObject->methodOffset()
             && PyMethod_Check(callback)) {
-            result.usingGlobalReceiver = true;
+            result.usingSlotObject = true;
         }
     }
 
-    const auto receiverThread = result.receiver ? result.receiver->thread() : nullptr;
-
-    if (result.usingGlobalReceiver) {
-        PySide::SignalManager &signalManager = PySide::SignalManager::instance();
-        result.receiver = signalManager.globalReceiver(source, callback);
-        // PYSIDE-1354: Move the global receiver to the original receivers's thread
-        // so that autoconnections work correctly.
-        if (receiverThread && receiverThread != result.receiver->thread())
-            result.receiver->moveToThread(receiverThread);
+    // Callables without a meta method are connected as functors. The receiver,
+    // if any, remains as context so that autoconnections work correctly (PYSIDE-1354).
+    if (result.usingSlotObject) {
         result.callbackSig =
             PySide::Signal::getCallbackSignature(signal, result.receiver, callback,
-                                                 result.usingGlobalReceiver).toLatin1();
-        const QMetaObject *metaObject = result.receiver->metaObject();
-        result.slotIndex = metaObject->indexOfSlot(result.callbackSig.constData());
+                                                 false).toLatin1();
+        result.slotIndex = -1;
     }
 
     return result;
@@ -208,48 +202,37 @@ QMetaObject::Connection qobjectConnectCallback(QObject *source, const char *sign
 
     // Extract receiver from callback
     const GetReceiverResult receiver = getReceiver(source, signal + 1, callback);
-    if (receiver.receiver == nullptr && receiver.self == nullptr)
+    if (receiver.receiver == nullptr && receiver.self == nullptr && !receiver.usingSlotObject)
         return {};
 
+    // QObjectPrivate::connect() notifies the source itself.
+    if (receiver.usingSlotObject) {
+        return PySide::SlotObject::connect(source, signalIndex, receiver.callbackSig,
+                                           callback, receiver.receiver, type);
+    }
+
     int slotIndex = receiver.slotIndex;
 
-    PySide::SignalManager &signalManager = PySide::SignalManager::instance();
     if (slotIndex == -1) {
-        if (!receiver.usingGlobalReceiver && receiver.self
+        if (receiver.self
             && !Shiboken::Object::hasCppWrapper(reinterpret_cast<SbkObject *>(receiver.self))) {
             qWarning("You can't add dynamic slots on an object originated from C++.");
-            if (receiver.usingGlobalReceiver)
-                signalManager.releaseGlobalReceiver(source, receiver.receiver);
-
             return {};
         }
 
         const char *slotSignature = receiver.callbackSig.constData();
-        slotIndex = receiver.usingGlobalReceiver
-            ? signalManager.globalReceiverSlotIndex(receiver.receiver, slotSignature)
-            : PySide::SignalManager::registerMetaMethodGetIndex(receiver.receiver, slotSignature,
-                                                                QMetaMethod::Slot);
-
-        if (slotIndex == -1) {
-            if (receiver.usingGlobalReceiver)
-                signalManager.releaseGlobalReceiver(source, receiver.receiver);
-
+        slotIndex = PySide::SignalManager::registerMetaMethodGetIndex(receiver.receiver, slotSignature,
+                                                                      QMetaMethod::Slot);
+        if (slotIndex == -1)
             return {};
-        }
     }
 
     auto connection = QMetaObject::connect(source, signalIndex, receiver.receiver, slotIndex, type);
-    if (!connection) {
-        if (receiver.usingGlobalReceiver)
-            signalManager.releaseGlobalReceiver(source, receiver.receiver);
+    if (!connection)
         return {};
-    }
 
     Q_ASSERT(receiver.receiver);
-    if (receiver.usingGlobalReceiver)
-        signalManager.notifyGlobalReceiver(receiver.receiver);
-
-    const QMetaMethod signalMethod = receiver.receiver->metaObject()->method(signalIndex);
+    const QMetaMethod signalMethod = source->metaObject()->method(signalIndex);
     static_cast<FriendlyQObject *>(source)->connectNotify(signalMethod);
     return connection;
 }
@@ -261,10 +244,15 @@ bool qobjectDisconnectCallback(QObject *source, const char *signal, PyObject *ca
 
     // Extract receiver from callback
     const GetReceiverResult receiver = getReceiver(nullptr, signal, callback);
-    if (receiver.receiver == nullptr && receiver.self == nullptr)
+    if (receiver.receiver == nullptr && receiver.self == nullptr && !receiver.usingSlotObject)
         return false;
 
     const int signalIndex = source->metaObject()->indexOfSignal(signal + 1);
+
+    // QObject::disconnect(const QMetaObject::Connection &) notifies the source.
+    if (receiver.usingSlotObject)
+        return PySide::SlotObject::disconnect(source, signalIndex, callback);
+
     const int slotIndex = receiver.slotIndex;
 
     if (!QMetaObject::disconnectOne(source, signalIndex, receiver.receiver, slotIndex))
@@ -273,11 +261,6 @@ bool qobjectDisconnectCallback(QObject *source, const char *signal, PyObject *ca
     Q_ASSERT(receiver.receiver);
     const QMetaMethod slotMethod = receiver.receiver->metaObject()->method(slotIndex);
     static_cast<FriendlyQObject *>(source)->disconnectNotify(slotMethod);
-
-    if (receiver.usingGlobalReceiver) { // might delete the receiver
-        PySide::SignalManager &signalManager = PySide::SignalManager::instance();
-        signalManager.releaseGlobalReceiver(source, receiver.receiver);
-    }
     return true;
 }
 
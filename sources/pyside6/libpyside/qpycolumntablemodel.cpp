@@ -0,0 +1,444 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qpycolumntablemodel.h"
+#include "pysideutils.h"
+
+#include <autodecref.h>
+#include <gilstate.h>
+#include <sbkpython.h>
+
+#include <QtCore/QLocale>
+#include <QtCore/QStringList>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace {
+
+struct QPyColumn
+{
+    QString title;
+    Py_buffer view;
+    bool hasView = false;
+    char kind = 0; // 'i', 'u', 'f', '?' for buffers, 's' for strings
+    const char *data = nullptr;
+    Py_ssize_t size = 0;
+    Py_ssize_t stride = 0;
+    Py_ssize_t itemSize = 0;
+    QStringList strings;
+    char format = 0;
+    int precision = -1;
+};
+
+} // namespace
+
+class QPyColumnTableModelPrivate
+{
+public:
+    void releaseColumns();
+
+    std::vector<QPyColumn> columns;
+    QList<int> customRoles;
+    int rowCount = 0;
+};
+
+// Called with the GIL held.
+void QPyColumnTableModelPrivate::releaseColumns()
+{
+    for (auto &column : columns) {
+        if (column.hasView)
+            PyBuffer_Release(&column.view);
+    }
+    columns.clear();
+    rowCount = 0;
+}
+
+// Returns the kind ('i', 'u', 'f', '?') of a struct module format of a
+// native number, or 0.
+static char bufferNumberKind(const char *format)
+{
+    if (format == nullptr)
+        return 'u';
+    switch (*format) {
+    case '@':
+    case '=':
+        ++format;
+        break;
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    case '<':
+#else
+    case '>':
+    case '!':
+#endif
+        ++format;
+        break;
+    default:
+        break;
+    }
+    if (format[0] == '\0' || format[1] != '\0')
+        return 0;
+    switch (format[0]) {
+    case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+        return 'i';
+    case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+        return 'u';
+    case 'f': case 'd':
+        return 'f';
+    case '?':
+        return '?';
+    default:
+        break;
+    }
+    return 0;
+}
+
+static bool isSupportedItemSize(char kind, Py_ssize_t itemSize)
+{
+    switch (kind) {
+    case 'i':
+    case 'u':
+        return itemSize == 1 || itemSize == 2 || itemSize == 4 || itemSize == 8;
+    case 'f':
+        return itemSize == sizeof(float) || itemSize == sizeof(double);
+    case '?':
+        return itemSize == sizeof(bool);
+    default:
+        break;
+    }
+    return false;
+}
+
+template <class T>
+static inline T readItem(const char *data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+static qint64 readSigned(const char *data, Py_ssize_t itemSize)
+{
+    switch (itemSize) {
+    case 1:
+        return readItem<qint8>(data);
+    case 2:
+        return readItem<qint16>(data);
+    case 4:
+        return readItem<qint32>(data);
+    default:
+        break;
+    }
+    return readItem<qint64>(data);
+}
+
+static quint64 readUnsigned(const char *data, Py_ssize_t itemSize)
+{
+    switch (itemSize) {
+    case 1:
+        return readItem<quint8>(data);
+    case 2:
+        return readItem<quint16>(data);
+    case 4:
+        return readItem<quint32>(data);
+    default:
+        break;
+    }
+    return readItem<quint64>(data);
+}
+
+static double readFloat(const char *data, Py_ssize_t itemSize)
+{
+    return itemSize == sizeof(float) ? double(readItem<float>(data)) : readItem<double>(data);
+}
+
+// Returns the value of a numeric cell as it would be obtained from Python.
+static QVariant numericValue(const QPyColumn &column, const char *item)
+{
+    switch (column.kind) {
+    case 'i': {
+        const qint64 value = readSigned(item, column.itemSize);
+        if (value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max())
+            return QVariant(int(value));
+        return QVariant(qlonglong(value));
+    }
+    case 'u': {
+        const quint64 value = readUnsigned(item, column.itemSize);
+        if (value <= quint64(std::numeric_limits<int>::max()))
+            return QVariant(int(value));
+        if (value <= quint64(std::numeric_limits<qlonglong>::max()))
+            return QVariant(qlonglong(value));
+        return QVariant(qulonglong(value));
+    }
+    case 'f':
+        return QVariant(readFloat(item, column.itemSize));
+    case '?':
+        return QVariant(readItem<bool>(item));
+    default:
+        break;
+    }
+    return {};
+}
+
+static QVariant numericDisplayValue(const QPyColumn &column, const char *item)
+{
+    switch (column.kind) {
+    case 'i':
+        if (column.format == 0)
+            return QString::number(readSigned(item, column.itemSize));
+        return QString::number(double(readSigned(item, column.itemSize)),
+                               column.format, column.precision >= 0 ? column.precision : 6);
+    case 'u':
+        if (column.format == 0)
+            return QString::number(readUnsigned(item, column.itemSize));
+        return QString::number(double(readUnsigned(item, column.itemSize)),
+                               column.format, column.precision >= 0 ? column.precision : 6);
+    case 'f':
+        if (column.format == 0)
+            return QString::number(readFloat(item, column.itemSize), 'g',
+                                   column.precision >= 0 ? column.precision
+                                                         : QLocale::FloatingPointShortest);
+        return QString::number(readFloat(item, column.itemSize),
+                               column.format, column.precision >= 0 ? column.precision : 6);
+    default:
+        break;
+    }
+    return numericValue(column, item);
+}
+
+// Initialize a column from a one-dimensional buffer of numbers. Returns false
+// for other objects, which are then treated as sequences.
+static bool initBufferColumn(QPyColumn *column, PyObject *obj)
+{
+    if (PyObject_CheckBuffer(obj) == 0)
+        return false;
+    Py_buffer &view = column->view;
+    if (PyObject_GetBuffer(obj, &view, PyBUF_FORMAT | PyBUF_STRIDES) != 0) {
+        PyErr_Clear();
+        return false;
+    }
+    const char kind = view.ndim == 1 ? bufferNumberKind(view.format) : 0;
+    if (kind == 0 || !isSupportedItemSize(kind, view.itemsize)) {
+        PyBuffer_Release(&view);
+        return false;
+    }
+    column->hasView = true;
+    column->kind = kind;
+    column->data = static_cast<const char *>(view.buf);
+    column->itemSize = view.itemsize;
+    column->size = view.shape != nullptr ? view.shape[0] : view.len / view.itemsize;
+    column->stride = view.strides != nullptr ? view.strides[0] : view.itemsize;
+    return true;
+}
+
+static bool initStringColumn(QPyColumn *column, PyObject *obj)
+{
+    if (PyUnicode_Check(obj) || PyBytes_Check(obj) || PySequence_Check(obj) == 0) {
+        PyErr_Format(PyExc_TypeError,
+                     "A column must be a buffer of numbers or a sequence, not \"%s\".",
+                     Py_TYPE(obj)->tp_name);
+        return false;
+    }
+    // Copy to a tuple so that __str__() of an item cannot modify the sequence
+    // being iterated.
+    Shiboken::AutoDecRef items(PySequence_Tuple(obj));
+    if (items.isNull())
+        return false;
+    const Py_ssize_t size = PyTuple_Size(items.object());
+    column->strings.reserve(size);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *item = PyTuple_GetItem(items.object(), i);
+        if (PyUnicode_Check(item)) {
+            column->strings.append(PySide::pyStringToQString(item));
+        } else if (item == Py_None) {
+            column->strings.append(QString());
+        } else {
+            Shiboken::AutoDecRef str(PyObject_Str(item));
+            if (str.isNull())
+                return false;
+            column->strings.append(PySide::pyStringToQString(str.object()));
+        }
+    }
+    column->kind = 's';
+    column->size = size;
+    return true;
+}
+
+QPyColumnTableModel::QPyColumnTableModel(QObject *parent) :
+    QAbstractTableModel(parent),
+    d(new QPyColumnTableModelPrivate)
+{
+}
+
+QPyColumnTableModel::~QPyColumnTableModel()
+{
+    if (!d->columns.empty()) {
+        Shiboken::GilState gil;
+        if (Py_IsInitialized())
+            d->releaseColumns();
+    }
+    delete d;
+}
+
+int QPyColumnTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : d->rowCount;
+}
+
+int QPyColumnTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : int(d->columns.size());
+}
+
+QVariant QPyColumnTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.column() >= int(d->columns.size()))
+        return {};
+    if (!d->customRoles.isEmpty() && d->customRoles.contains(role))
+        return customData(index, role);
+
+    const QPyColumn &column = d->columns[size_t(index.column())];
+    const int row = index.row();
+    if (row >= column.size)
+        return {};
+
+    if (column.kind == 's') {
+        switch (role) {
+        case Qt::DisplayRole:
+        case Qt::EditRole:
+            return column.strings.at(row);
+        default:
+            break;
+        }
+        return {};
+    }
+
+    const char *item = column.data + row * column.stride;
+    switch (role) {
+    case Qt::DisplayRole:
+        return numericDisplayValue(column, item);
+    case Qt::EditRole:
+        return numericValue(column, item);
+    case Qt::TextAlignmentRole:
+        if (column.kind != '?')
+            return int(Qt::AlignRight | Qt::AlignVCenter);
+        break;
+    default:
+        break;
+    }
+    return {};
+}
+
+QVariant QPyColumnTableModel::headerData(int section, Qt::Orientation orientation,
+                                         int role) const
+{
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole
+        && section >= 0 && section < int(d->columns.size())) {
+        const QString &title = d->columns[size_t(section)].title;
+        if (!title.isEmpty())
+            return title;
+    }
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+bool QPyColumnTableModel::addColumn(PyObject *column, const QString &title)
+{
+    QPyColumn newColumn;
+    if (!initBufferColumn(&newColumn, column) && !initStringColumn(&newColumn, column))
+        return false;
+    newColumn.title = title;
+
+    beginResetModel();
+    d->columns.push_back(newColumn);
+    d->rowCount = std::max(d->rowCount, int(std::min(newColumn.size, Py_ssize_t(std::numeric_limits<int>::max()))));
+    endResetModel();
+    return true;
+}
+
+void QPyColumnTableModel::clear()
+{
+    beginResetModel();
+    {
+        Shiboken::GilState gil;
+        d->releaseColumns();
+    }
+    endResetModel();
+}
+
+QString QPyColumnTableModel::columnTitle(int column) const
+{
+    return column >= 0 && column < int(d->columns.size())
+        ? d->columns[size_t(column)].title : QString();
+}
+
+void QPyColumnTableModel::setColumnTitle(int column, const QString &title)
+{
+    if (column < 0 || column >= int(d->columns.size()))
+        return;
+    d->columns[size_t(column)].title = title;
+    Q_EMIT headerDataChanged(Qt::Horizontal, column, column);
+}
+
+void QPyColumnTableModel::setColumnFormat(int column, char format, int precision)
+{
+    if (column < 0 || column >= int(d->columns.size()))
+        return;
+    auto &c = d->columns[size_t(column)];
+    c.format = format;
+    c.precision = precision;
+    if (d->rowCount > 0)
+        Q_EMIT dataChanged(index(0, column), index(d->rowCount - 1, column), {Qt::DisplayRole});
+}
+
+QList<int> QPyColumnTableModel::customRoles() const
+{
+    return d->customRoles;
+}
+
+void QPyColumnTableModel::setCustomRoles(const QList<int> &roles)
+{
+    d->customRoles = roles;
+}
+
+QVariant QPyColumnTableModel::customData(const QModelIndex &, int) const
+{
+    return {};
+}
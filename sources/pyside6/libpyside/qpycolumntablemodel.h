@@ -0,0 +1,97 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QPYCOLUMNTABLEMODEL_H
+#define QPYCOLUMNTABLEMODEL_H
+
+#include <pysidemacros.h>
+
+#include <QtCore/QAbstractTableModel>
+#include <QtCore/QList>
+
+struct _object; // PyObject
+
+class QPyColumnTableModelPrivate;
+
+/// A table model whose columns are Python objects exposing the buffer
+/// protocol (numpy arrays, array.array) or sequences of strings.
+/// data() and headerData() are answered in C++ without acquiring the GIL;
+/// only the roles passed to setCustomRoles() are forwarded to customData(),
+/// which Python subclasses may override.
+class PYSIDE_API QPyColumnTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    explicit QPyColumnTableModel(QObject *parent = nullptr);
+    ~QPyColumnTableModel() override;
+
+    int rowCount(const QModelIndex &parent = {}) const override;
+    int columnCount(const QModelIndex &parent = {}) const override;
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const final;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const final;
+
+    /// Append a column. \a column is either a one-dimensional buffer of
+    /// numbers, which is referenced for the lifetime of the column, or a
+    /// sequence whose items are converted to strings once.
+    /// \return false with a Python error set if \a column is not supported.
+    bool addColumn(_object *column, const QString &title = {});
+    void clear();
+
+    QString columnTitle(int column) const;
+    void setColumnTitle(int column, const QString &title);
+
+    /// Set the QString::number() format ('e', 'E', 'f', 'g', 'G') and
+    /// precision used for the display role of a numeric column.
+    void setColumnFormat(int column, char format, int precision = -1);
+
+    QList<int> customRoles() const;
+    void setCustomRoles(const QList<int> &roles);
+
+protected:
+    virtual QVariant customData(const QModelIndex &index, int role) const;
+
+private:
+    Q_DISABLE_COPY(QPyColumnTableModel)
+
+    QPyColumnTableModelPrivate *d;
+};
+
+#endif // QPYCOLUMNTABLEMODEL_H
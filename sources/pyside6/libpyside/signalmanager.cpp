@@ -45,7 +45,9 @@
 #include "pysidecleanup.h"
 #include "pyside_p.h"
 #include "dynamicqmetaobject.h"
+#include "dynamicqmetaobject_p.h"
 #include "pysidemetafunction_p.h"
+#include "pysideqslotobject_p.h"
 
 #include <autodecref.h>
 #include <basewrapper.h>
@@ -57,22 +59,42 @@
 
 #include <QtCore/QDebug>
 #include <QtCore/QHash>
+#include <QtCore/QtEndian>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
+#include <optional>
+#include <vector>
 
 #if QSLOT_CODE != 1 || QSIGNAL_CODE != 2
 #error QSLOT_CODE and/or QSIGNAL_CODE changed! change the hardcoded stuff to the correct value!
 #endif
 #define PYSIDE_SLOT '1'
 #define PYSIDE_SIGNAL '2'
-#include "globalreceiverv2.h"
 
 namespace {
     static PyObject *metaObjectAttr = nullptr;
 
+    // Converters for the parameters and the return type of a meta method,
+    // resolved once from the type names and cached per meta method index,
+    // grouped by meta object so that they can be dropped when it is rebuilt.
+    struct MethodConverters
+    {
+        std::vector<Shiboken::Conversions::SpecificConverter> parameters;
+        std::optional<Shiboken::Conversions::SpecificConverter> returnConverter;
+    };
+
+    using MetaObjectMethodConverters = QHash<int, MethodConverters>;
+    using MethodConverterCache = QHash<const QMetaObject *, MetaObjectMethodConverters>;
+
+    static MethodConverterCache methodConverterCache;
+    static PySide::SignalManager::MethodCacheStatistics methodCacheStats;
+
+    static const MethodConverters &methodConverters(const QMetaMethod &method);
     static int callMethod(QObject *object, int id, void **args);
-    static PyObject *parseArguments(const QList< QByteArray >& paramTypes, void **args);
+    static PyObject *parseArguments(const QMetaMethod &method, const MethodConverters &converters,
+                                    void **args);
     static bool emitShortCircuitSignal(QObject *source, int signalIndex, PyObject *args);
 
     static void destroyMetaObject(PyObject *obj)
@@ -144,6 +166,271 @@ PyObjectWrapper::operator PyObject *() const
     return m_me;
 }
 
+// Compact binary encoding of PyObjectWrapper for common payloads (None, bool,
+// int, float, str, bytes and lists, tuples and dicts thereof). Like pickle
+// data, which is used for all other objects, it is streamed as a QByteArray.
+// It starts with a marker that pickle data cannot start with (0 is not a
+// pickle opcode) followed by a version, so that older streams still load.
+namespace BinaryEncoding {
+
+static constexpr char marker[] = {'\0', 'P', 'y', 'O'};
+static constexpr qsizetype markerSize = qsizetype(sizeof(marker));
+static constexpr char version = 1;
+static constexpr int maxDepth = 32; // Leave deeply nested/recursive data to pickle
+
+enum Tag : char
+{
+    NoneTag = 'N',
+    TrueTag = 'T',
+    FalseTag = 'F',
+    IntTag = 'i', // qint64
+    FloatTag = 'd',
+    StrTag = 's', // quint32 size, UTF-8
+    BytesTag = 'b', // quint32 size, data
+    ListTag = 'l', // quint32 count, items
+    TupleTag = 't', // quint32 count, items
+    DictTag = 'D' // quint32 count, key/value pairs
+};
+
+template <class T>
+static void appendValue(QByteArray &data, T value)
+{
+    value = qToLittleEndian(value);
+    data.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+static bool appendSize(QByteArray &data, Tag tag, Py_ssize_t size)
+{
+    if (size < 0 || quint64(size) > std::numeric_limits<quint32>::max())
+        return false;
+    data.append(char(tag));
+    appendValue(data, quint32(size));
+    return true;
+}
+
+static bool appendString(QByteArray &data, PyObject *str)
+{
+#ifdef Py_LIMITED_API
+    Shiboken::AutoDecRef utf8(PyUnicode_AsUTF8String(str));
+    if (utf8.isNull()) {
+        PyErr_Clear(); // Lone surrogates, leave them to pickle
+        return false;
+    }
+    const char *buffer = PyBytes_AS_STRING(utf8.object());
+    const Py_ssize_t size = PyBytes_GET_SIZE(utf8.object());
+#else
+    Py_ssize_t size = 0;
+    const char *buffer = PyUnicode_AsUTF8AndSize(str, &size);
+    if (buffer == nullptr) {
+        PyErr_Clear(); // Lone surrogates, leave them to pickle
+        return false;
+    }
+#endif
+    if (!appendSize(data, StrTag, size))
+        return false;
+    data.append(buffer, size);
+    return true;
+}
+
+// Encode an object, returning false for objects which need to be pickled.
+// Only exact types are encoded to preserve subclasses like enumerations.
+static bool encode(QByteArray &data, PyObject *obj, int depth = 0)
+{
+    if (obj == Py_None) {
+        data.append(char(NoneTag));
+        return true;
+    }
+    if (obj == Py_True || obj == Py_False) {
+        data.append(char(obj == Py_True ? TrueTag : FalseTag));
+        return true;
+    }
+    if (PyLong_CheckExact(obj)) {
+        int overflow = 0;
+        const long long value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+        if (overflow != 0)
+            return false;
+        data.append(char(IntTag));
+        appendValue(data, qint64(value));
+        return true;
+    }
+    if (PyFloat_CheckExact(obj)) {
+        const double value = PyFloat_AsDouble(obj);
+        quint64 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        data.append(char(FloatTag));
+        appendValue(data, bits);
+        return true;
+    }
+    if (PyUnicode_CheckExact(obj))
+        return appendString(data, obj);
+    if (PyBytes_CheckExact(obj)) {
+        const Py_ssize_t size = PyBytes_GET_SIZE(obj);
+        if (!appendSize(data, BytesTag, size))
+            return false;
+        data.append(PyBytes_AS_STRING(obj), size);
+        return true;
+    }
+
+    if (depth >= maxDepth)
+        return false;
+    if (PyList_CheckExact(obj)) {
+        const Py_ssize_t size = PyList_Size(obj);
+        if (!appendSize(data, ListTag, size))
+            return false;
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            if (!encode(data, PyList_GetItem(obj, i), depth + 1))
+                return false;
+        }
+        return true;
+    }
+    if (PyTuple_CheckExact(obj)) {
+        const Py_ssize_t size = PyTuple_Size(obj);
+        if (!appendSize(data, TupleTag, size))
+            return false;
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            if (!encode(data, PyTuple_GetItem(obj, i), depth + 1))
+                return false;
+        }
+        return true;
+    }
+    if (PyDict_CheckExact(obj)) {
+        if (!appendSize(data, DictTag, PyDict_Size(obj)))
+            return false;
+        PyObject *key{};
+        PyObject *value{};
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(obj, &pos, &key, &value)) {
+            if (!encode(data, key, depth + 1) || !encode(data, value, depth + 1))
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+class Decoder
+{
+public:
+    explicit Decoder(const QByteArray &data) :
+        m_pos(data.constData() + markerSize + 1),
+        m_end(data.constData() + data.size())
+    {
+    }
+
+    // Decode an object, returning a new reference or nullptr for corrupt data
+    PyObject *decode(int depth = 0)
+    {
+        if (m_pos >= m_end || depth > maxDepth)
+            return nullptr;
+        switch (*m_pos++) {
+        case NoneTag:
+            Py_RETURN_NONE;
+        case TrueTag:
+            Py_RETURN_TRUE;
+        case FalseTag:
+            Py_RETURN_FALSE;
+        case IntTag: {
+            qint64 value;
+            return readValue(&value) ? PyLong_FromLongLong(value) : nullptr;
+        }
+        case FloatTag: {
+            quint64 bits;
+            if (!readValue(&bits))
+                return nullptr;
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return PyFloat_FromDouble(value);
+        }
+        case StrTag: {
+            quint32 size;
+            if (!readSize(&size, 1))
+                return nullptr;
+            PyObject *result = PyUnicode_DecodeUTF8(m_pos, size, nullptr);
+            m_pos += size;
+            return result;
+        }
+        case BytesTag: {
+            quint32 size;
+            if (!readSize(&size, 1))
+                return nullptr;
+            PyObject *result = PyBytes_FromStringAndSize(m_pos, size);
+            m_pos += size;
+            return result;
+        }
+        case ListTag:
+        case TupleTag: {
+            const bool isList = m_pos[-1] == ListTag;
+            quint32 size;
+            if (!readSize(&size, 1))
+                return nullptr;
+            PyObject *result = isList ? PyList_New(size) : PyTuple_New(size);
+            if (result == nullptr)
+                return nullptr;
+            for (quint32 i = 0; i < size; ++i) {
+                PyObject *item = decode(depth + 1);
+                if (item == nullptr) {
+                    Py_DECREF(result);
+                    return nullptr;
+                }
+                if (isList)
+                    PyList_SetItem(result, i, item);
+                else
+                    PyTuple_SetItem(result, i, item);
+            }
+            return result;
+        }
+        case DictTag: {
+            quint32 size;
+            if (!readSize(&size, 2))
+                return nullptr;
+            PyObject *result = PyDict_New();
+            for (quint32 i = 0; result != nullptr && i < size; ++i) {
+                Shiboken::AutoDecRef key(decode(depth + 1));
+                Shiboken::AutoDecRef value(key.isNull() ? nullptr : decode(depth + 1));
+                if (value.isNull() || PyDict_SetItem(result, key, value) != 0)
+                    Py_CLEAR(result);
+            }
+            return result;
+        }
+        default:
+            break;
+        }
+        return nullptr;
+    }
+
+    bool atEnd() const { return m_pos == m_end; }
+
+private:
+    template <class T>
+    bool readValue(T *value)
+    {
+        if (m_end - m_pos < qsizetype(sizeof(T)))
+            return false;
+        std::memcpy(value, m_pos, sizeof(T));
+        *value = qFromLittleEndian(*value);
+        m_pos += sizeof(T);
+        return true;
+    }
+
+    // Read a size, checking it against the remaining data (each item
+    // occupies at least itemSize bytes).
+    bool readSize(quint32 *size, quint32 itemSize)
+    {
+        return readValue(size) && quint64(*size) * itemSize <= quint64(m_end - m_pos);
+    }
+
+    const char *m_pos;
+    const char *m_end;
+};
+
+static bool isEncoded(const QByteArray &data)
+{
+    return data.size() > markerSize
+        && std::memcmp(data.constData(), marker, markerSize) == 0;
+}
+
+} // namespace BinaryEncoding
+
 QDataStream &operator<<(QDataStream &out, const PyObjectWrapper &myObj)
 {
     if (Py_IsInitialized() == 0) {
@@ -154,11 +441,21 @@ QDataStream &operator<<(QDataStream &out, const PyObjectWrapper &myObj)
     static PyObject *reduce_func = nullptr;
 
     Shiboken::GilState gil;
+    PyObject *pyObj = myObj;
+
+    QByteArray data;
+    data.reserve(256);
+    data.append(BinaryEncoding::marker, BinaryEncoding::markerSize);
+    data.append(BinaryEncoding::version);
+    if (BinaryEncoding::encode(data, pyObj)) {
+        out << data;
+        return out;
+    }
+
     if (!reduce_func) {
         Shiboken::AutoDecRef pickleModule(PyImport_ImportModule("pickle"));
         reduce_func = PyObject_GetAttr(pickleModule, Shiboken::PyName::dumps());
     }
-    PyObject *pyObj = myObj;
     Shiboken::AutoDecRef repr(PyObject_CallFunctionObjArgs(reduce_func, pyObj, nullptr));
     if (repr.object()) {
         const char *buff = nullptr;
@@ -170,8 +467,8 @@ QDataStream &operator<<(QDataStream &out, const PyObjectWrapper &myObj)
             buff = Shiboken::String::toCString(repr.object());
             size = Shiboken::String::len(repr.object());
         }
-        QByteArray data(buff, size);
-        out << data;
+        // Same format as streaming a QByteArray, avoiding the copy
+        out.writeBytes(buff, uint(size));
     }
     return out;
 }
@@ -186,14 +483,37 @@ QDataStream &operator>>(QDataStream &in, PyObjectWrapper &myObj)
     static PyObject *eval_func = nullptr;
 
     Shiboken::GilState gil;
+
+    QByteArray repr;
+    in >> repr;
+
+    if (BinaryEncoding::isEncoded(repr)) {
+        const auto version = static_cast<unsigned char>(repr.at(BinaryEncoding::markerSize));
+        PyObject *value = nullptr;
+        if (version == static_cast<unsigned char>(BinaryEncoding::version)) {
+            BinaryEncoding::Decoder decoder(repr);
+            value = decoder.decode();
+            if (value != nullptr && !decoder.atEnd())
+                Py_CLEAR(value);
+            if (value == nullptr) {
+                PyErr_Clear();
+                qWarning("Stream operator for PyObject: Invalid data.");
+            }
+        } else {
+            qWarning("Stream operator for PyObject: Unsupported version %d.", int(version));
+        }
+        myObj.reset(value != nullptr ? value : Py_None);
+        Py_XDECREF(value);
+        return in;
+    }
+
     if (!eval_func) {
         Shiboken::AutoDecRef pickleModule(PyImport_ImportModule("pickle"));
         eval_func = PyObject_GetAttr(pickleModule, Shiboken::PyName::loads());
     }
 
-    QByteArray repr;
-    in >> repr;
-    Shiboken::AutoDecRef pyCode(PyBytes_FromStringAndSize(repr.data(), repr.size()));
+    Shiboken::AutoDecRef pyCode(PyMemoryView_FromMemory(const_cast<char *>(repr.constData()),
+                                                        repr.size(), PyBUF_READ));
     Shiboken::AutoDecRef value(PyObject_CallFunctionObjArgs(eval_func, pyCode.object(), 0));
     if (!value.object())
         value.reset(Py_None);
@@ -207,24 +527,7 @@ using namespace PySide;
 
 struct SignalManager::SignalManagerPrivate
 {
-    GlobalReceiverV2MapPtr m_globalReceivers;
     static SignalManager::QmlMetaCallErrorHandler m_qmlMetaCallErrorHandler;
-
-    SignalManagerPrivate() : m_globalReceivers(new GlobalReceiverV2Map{})
-    {
-    }
-
-    ~SignalManagerPrivate()
-    {
-        if (!m_globalReceivers.isNull()) {
-            // Delete receivers by always retrieving the current first element, because deleting a
-            // receiver can indirectly delete another one, and if we use qDeleteAll, that could
-            // cause either a double delete, or iterator invalidation, and thus undefined behavior.
-            while (!m_globalReceivers->isEmpty())
-                delete *m_globalReceivers->cbegin();
-            Q_ASSERT(m_globalReceivers->isEmpty());
-        }
-    }
 };
 
 SignalManager::QmlMetaCallErrorHandler
@@ -275,6 +578,7 @@ SignalManager::SignalManager() : m_d(new SignalManagerPrivate)
 
 void SignalManager::clear()
 {
+    PySide::SlotObject::disconnectAll();
     delete m_d;
     m_d = new SignalManagerPrivate();
 }
@@ -295,54 +599,6 @@ void SignalManager::setQmlMetaCallErrorHandler(QmlMetaCallErrorHandler handler)
     SignalManagerPrivate::m_qmlMetaCallErrorHandler = handler;
 }
 
-QObject *SignalManager::globalReceiver(QObject *sender, PyObject *callback)
-{
-    GlobalReceiverV2MapPtr globalReceivers = m_d->m_globalReceivers;
-    GlobalReceiverKey key = GlobalReceiverV2::key(callback);
-    GlobalReceiverV2 *gr = nullptr;
-    auto it = globalReceivers->find(key);
-    if (it == globalReceivers->end()) {
-        gr = new GlobalReceiverV2(callback, globalReceivers);
-        globalReceivers->insert(key, gr);
-        if (sender) {
-            gr->incRef(sender); // create a link reference
-            gr->decRef(); // remove extra reference
-        }
-    } else {
-        gr = it.value();
-        if (sender)
-            gr->incRef(sender);
-    }
-
-    return reinterpret_cast<QObject *>(gr);
-}
-
-int SignalManager::countConnectionsWith(const QObject *object)
-{
-    int count = 0;
-    for (GlobalReceiverV2Map::const_iterator it = m_d->m_globalReceivers->cbegin(), end = m_d->m_globalReceivers->cend(); it != end; ++it) {
-        if (it.value()->refCount(object))
-            count++;
-    }
-    return count;
-}
-
-void SignalManager::notifyGlobalReceiver(QObject *receiver)
-{
-    reinterpret_cast<GlobalReceiverV2 *>(receiver)->notify();
-}
-
-void SignalManager::releaseGlobalReceiver(const QObject *source, QObject *receiver)
-{
-    auto gr = reinterpret_cast<GlobalReceiverV2 *>(receiver);
-    gr->decRef(source);
-}
-
-int SignalManager::globalReceiverSlotIndex(QObject *receiver, const char *signature) const
-{
-    return reinterpret_cast<GlobalReceiverV2 *>(receiver)->addSlot(signature);
-}
-
 bool SignalManager::emitSignal(QObject *source, const char *signal, PyObject *args)
 {
     if (!Signal::checkQtSignal(signal))
@@ -364,6 +620,7 @@ bool SignalManager::emitSignal(QObject *source, const char *signal, PyObject *ar
 
 int SignalManager::qt_metacall(QObject *object, QMetaObject::Call call, int id, void **args)
 {
+    MetaCallGuard metaCallGuard;
     const QMetaObject *metaObject = object->metaObject();
     PySideProperty *pp = nullptr;
     PyObject *pp_name = nullptr;
@@ -451,40 +708,53 @@ int SignalManager::callPythonMetaMethod(const QMetaMethod &method, void **args,
     Q_ASSERT(pyMethod);
 
     Shiboken::GilState gil;
-    PyObject *pyArguments = nullptr;
+    const MethodConverters &converters = methodConverters(method);
+    // Copy the return converter, the cache may be modified by the Python call.
+    auto retConverter = converters.returnConverter;
 
-    if (isShortCuit){
-        pyArguments = reinterpret_cast<PyObject *>(args[1]);
-    } else {
-        pyArguments = parseArguments(method.parameterTypes(), args);
-    }
+    PyObject *pyArguments = isShortCuit
+        ? reinterpret_cast<PyObject *>(args[1]) : parseArguments(method, converters, args);
 
     if (pyArguments) {
-        Shiboken::Conversions::SpecificConverter *retConverter = nullptr;
-        const char *returnType = method.typeName();
-        if (returnType && std::strcmp("", returnType) && std::strcmp("void", returnType)) {
-            retConverter = new Shiboken::Conversions::SpecificConverter(returnType);
-            if (!retConverter || !*retConverter) {
-                PyErr_Format(PyExc_RuntimeError, "Can't find converter for '%s' to call Python meta method.", returnType);
-                return -1;
-            }
+        if (retConverter.has_value() && !retConverter.value()) {
+            PyErr_Format(PyExc_RuntimeError, "Can't find converter for '%s' to call Python meta method.",
+                         method.typeName());
+            if (!isShortCuit)
+                Py_DECREF(pyArguments);
+            return -1;
         }
 
         Shiboken::AutoDecRef retval(PyObject_CallObject(pyMethod, pyArguments));
 
-        if (!isShortCuit && pyArguments){
+        if (!isShortCuit)
             Py_DECREF(pyArguments);
-        }
 
-        if (!retval.isNull() && retval != Py_None && !PyErr_Occurred() && retConverter) {
+        if (!retval.isNull() && retval != Py_None && !PyErr_Occurred() && retConverter.has_value())
             retConverter->toCpp(retval, args[0]);
-        }
-        delete retConverter;
     }
 
     return -1;
 }
 
+SignalManager::MethodCacheStatistics SignalManager::methodCacheStatistics()
+{
+    MethodCacheStatistics result = methodCacheStats;
+    result.size = 0;
+    for (const auto &converters : qAsConst(methodConverterCache))
+        result.size += converters.size();
+    return result;
+}
+
+void SignalManager::resetMethodCacheStatistics()
+{
+    methodCacheStats = {};
+}
+
+void SignalManager::invalidateMethodCache(const QMetaObject *metaObject)
+{
+    methodConverterCache.remove(metaObject);
+}
+
 bool SignalManager::registerMetaMethod(QObject *source, const char *signature, QMetaMethod::MethodType type)
 {
     int ret = registerMetaMethodGetIndex(source, signature, type);
@@ -532,6 +802,9 @@ int SignalManager::registerMetaMethodGetIndex(QObject *source, const char *signa
         // Create a instance meta object
         if (!dmo) {
             dmo = new MetaObjectBuilder(Py_TYPE(pySelf), metaObject);
+            // Instances of types registered with QML may be exposed to it.
+            if (retrieveTypeUserData(pySelf)->mo.retainsMetaObjects())
+                dmo->retainMetaObject();
             PyObject *pyDmo = PyCapsule_New(dmo, nullptr, destroyMetaObject);
             PyObject_SetAttr(pySelf, metaObjectAttr, pyDmo);
             Py_DECREF(pyDmo);
@@ -563,6 +836,16 @@ const QMetaObject *SignalManager::retrieveMetaObject(PyObject *self)
     return builder->update();
 }
 
+int SignalManager::retainedMetaObjectCount(PyObject *self)
+{
+    Q_ASSERT(self);
+
+    MetaObjectBuilder *builder = metaBuilderFromDict(SbkObject_GetDict(self));
+    if (!builder)
+        builder = &(retrieveTypeUserData(self)->mo);
+    return builder->retainedMetaObjectCount();
+}
+
 namespace {
 
 static int callMethod(QObject *object, int id, void **args)
@@ -585,19 +868,46 @@ static int callMethod(QObject *object, int id, void **args)
 }
 
 
-static PyObject *parseArguments(const QList<QByteArray>& paramTypes, void **args)
+static const MethodConverters &methodConverters(const QMetaMethod &method)
+{
+    auto &metaObjectConverters = methodConverterCache[method.enclosingMetaObject()];
+    const int key = method.methodIndex();
+    auto it = metaObjectConverters.constFind(key);
+    if (it != metaObjectConverters.cend()) {
+        ++methodCacheStats.hits;
+        return it.value();
+    }
+    ++methodCacheStats.misses;
+
+    // Invalid converters are cached as well, errors are reported on use.
+    MethodConverters converters;
+    const auto paramTypes = method.parameterTypes();
+    converters.parameters.reserve(paramTypes.size());
+    for (const auto &paramType : paramTypes)
+        converters.parameters.emplace_back(paramType.constData());
+
+    const char *returnType = method.typeName();
+    if (returnType && std::strcmp("", returnType) && std::strcmp("void", returnType))
+        converters.returnConverter.emplace(returnType);
+
+    return metaObjectConverters.insert(key, std::move(converters)).value();
+}
+
+static PyObject *parseArguments(const QMetaMethod &method, const MethodConverters &converters,
+                                void **args)
 {
-    int argsSize = paramTypes.count();
+    const auto argsSize = Py_ssize_t(converters.parameters.size());
     PyObject *preparedArgs = PyTuple_New(argsSize);
 
-    for (int i = 0, max = argsSize; i < max; ++i) {
-        void *data = args[i+1];
-        const char *dataType = paramTypes[i].constData();
-        Shiboken::Conversions::SpecificConverter converter(dataType);
+    for (Py_ssize_t i = 0; i < argsSize; ++i) {
+        // SpecificConverter::toPython() is not const.
+        auto converter = converters.parameters[i];
         if (converter) {
-            PyTuple_SET_ITEM(preparedArgs, i, converter.toPython(data));
+            PyTuple_SET_ITEM(preparedArgs, i, converter.toPython(args[i + 1]));
         } else {
-            PyErr_Format(PyExc_TypeError, "Can't call meta function because I have no idea how to handle %s", dataType);
+            const QByteArray dataType = method.parameterTypes().at(i);
+            PyErr_Format(PyExc_TypeError, "Can't call meta function because I have no idea how to handle %s",
+                         dataType.constData());
             Py_DECREF(preparedArgs);
             return nullptr;
         }
@@ -88,11 +88,6 @@ public:
 
     static void setQmlMetaCallErrorHandler(QmlMetaCallErrorHandler handler);
 
-    QObject* globalReceiver(QObject* sender, PyObject* callback);
-    void releaseGlobalReceiver(const QObject* sender, QObject* receiver);
-    int globalReceiverSlotIndex(QObject* sender, const char* slotSignature) const;
-    void notifyGlobalReceiver(QObject* receiver);
-
     bool emitSignal(QObject* source, const char* signal, PyObject* args);
     static int qt_metacall(QObject* object, QMetaObject::Call call, int id, void** args);
 
@@ -102,16 +97,28 @@ public:
 
     // used to discovery metaobject
     static const QMetaObject* retrieveMetaObject(PyObject* self);
+    // Number of meta objects retained by the meta object builder of self
+    static int retainedMetaObjectCount(PyObject *self);
 
-    // Used to discovery if SignalManager was connected with object "destroyed()" signal.
-    int countConnectionsWith(const QObject *object);
-
-    // Disconnect all signals managed by Globalreceiver
+    // Disconnect all signals connected to Python callables
     void clear();
 
     // Utility function to call a python method usign args received in qt_metacall
     static int callPythonMetaMethod(const QMetaMethod& method, void** args, PyObject* obj, bool isShortCuit);
 
+    // Statistics of the per meta method converter cache used by callPythonMetaMethod()
+    struct MethodCacheStatistics
+    {
+        quint64 hits = 0;
+        quint64 misses = 0;
+        qsizetype size = 0;
+    };
+
+    static MethodCacheStatistics methodCacheStatistics();
+    static void resetMethodCacheStatistics();
+    // Drop the cached converters of a meta object that is rebuilt or destroyed
+    static void invalidateMethodCache(const QMetaObject *metaObject);
+
 private:
     struct SignalManagerPrivate;
     SignalManagerPrivate* m_d;
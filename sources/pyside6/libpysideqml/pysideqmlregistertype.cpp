@@ -113,7 +113,7 @@ int qmlRegisterType(PyObject *pyObj, const char *uri, int versionMajor,
         return -1;
     }
 
-    const QMetaObject *metaObject = PySide::retrieveMetaObject(pyObjType);
+    const QMetaObject *metaObject = PySide::retainMetaObject(pyObjType);
     Q_ASSERT(metaObject);
 
     QQmlPrivate::RegisterType type;
@@ -209,7 +209,7 @@ int qmlRegisterSingletonType(PyObject *pyObj, const char *uri, int versionMajor,
         if (!hasCallback)
             Py_INCREF(pyObj);
 
-        metaObject = PySide::retrieveMetaObject(pyObjType);
+        metaObject = PySide::retainMetaObject(pyObjType);
         Q_ASSERT(metaObject);
     }
 
@@ -306,7 +306,7 @@ int qmlRegisterSingletonInstance(PyObject *pyObj, const char *uri, int versionMa
     QQmlPrivate::SingletonFunctor registrationFunctor;
     registrationFunctor.m_object = instanceQObject;
 
-    const QMetaObject *metaObject = PySide::retrieveMetaObject(pyObjType);
+    const QMetaObject *metaObject = PySide::retainMetaObject(pyObjType);
     Q_ASSERT(metaObject);
 
     QQmlPrivate::RegisterSingletonType type;
@@ -40,9 +40,15 @@ from init_paths import init_test_paths
 init_test_paths(False)
 
 from helper.usesqapplication import UsesQApplication
-from PySide6.QtCore import QRect, QSize, QTimer
+from PySide6.QtCore import QPointF, QRect, QSize, QTimer
 from PySide6.QtGui import QGuiApplication, QScreen
-from PySide6.QtCharts import QChart, QChartView, QPieSeries
+from PySide6.QtCharts import QChart, QChartView, QLineSeries, QPieSeries
+
+try:
+    import numpy as np
+    HAVE_NUMPY = True
+except ModuleNotFoundError:
+    HAVE_NUMPY = False
 
 
 class QChartsTestCase(UsesQApplication):
@@ -67,6 +73,30 @@ class QChartsTestCase(UsesQApplication):
         QTimer.singleShot(500, self.app.quit)
         self.app.exec()
 
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testXySeriesNumpy(self):
+        series = QLineSeries()
+        x = np.arange(4, dtype=np.int16)
+        y = np.array([0.5, -1, 1.5, -1, 2.5, -1, 3.5, -1, 4.5], dtype=np.float16)[::2]
+        try:
+            series.appendNp(x, y)
+        except TypeError:
+            self.skipTest("libpyside was built without numpy support")
+        self.assertEqual(series.points(), [QPointF(0, 0.5), QPointF(1, 1.5),
+                                           QPointF(2, 2.5), QPointF(3, 3.5)])
+        series.appendNp(x[:1], y[:1])
+        self.assertEqual(series.count(), 5)
+        series.replaceNp(np.array([1.0, 2.0]), np.array([3, 4], dtype=np.int64))
+        self.assertEqual(series.points(), [QPointF(1, 3), QPointF(2, 4)])
+        # The lists passed to replace() alternate.
+        for i in range(4):
+            series.replaceNp(np.arange(i + 1, dtype=np.float64), np.full(i + 1, i))
+            self.assertEqual(series.points(), [QPointF(j, i) for j in range(i + 1)])
+        swapped = np.arange(3, dtype=np.dtype(np.float64).newbyteorder())
+        self.assertRaises(TypeError, series.appendNp, swapped, swapped)
+        self.assertRaises(TypeError, series.replaceNp, swapped, swapped)
+        self.assertEqual(series.count(), 4)
+
 
 if __name__ == '__main__':
     unittest.main()
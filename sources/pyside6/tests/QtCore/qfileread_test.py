@@ -35,7 +35,7 @@ sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from init_paths import init_test_paths
 init_test_paths(False)
 
-from PySide6.QtCore import QIODevice, QTemporaryFile
+from PySide6.QtCore import QByteArray, QIODevice, QTemporaryFile
 
 
 class FileChild1(QTemporaryFile):
@@ -86,6 +86,33 @@ class readDataTest(unittest.TestCase):
         s1 = self.filename1.read(50)
         self.assertEqual(s1, s2)
 
+    def testReadInto(self):
+        '''QIODevice.readinto/peekinto into a reused buffer'''
+        self.filename1.seek(0)
+        buffer = bytearray(4)
+        self.assertEqual(self.filename1.peekinto(buffer), 4)
+        self.assertEqual(buffer, b'Test')
+        self.assertEqual(self.filename1.readinto(memoryview(buffer)), 4)
+        self.assertEqual(buffer, b'Test')
+        self.assertEqual(self.filename1.readinto(buffer), 4)
+        self.assertEqual(buffer, b' tex')
+        buffer = bytearray(100)
+        self.assertEqual(self.filename1.readinto(buffer), 13)
+        self.assertEqual(buffer[:13], b't for testing')
+        self.assertEqual(self.filename1.readinto(buffer), 0)
+        self.assertRaises(TypeError, self.filename1.readinto, b'read only')
+
+    def testWriteBuffer(self):
+        '''QIODevice.write from any buffer'''
+        f = QTemporaryFile()
+        self.assertTrue(f.open())
+        self.assertEqual(f.write(b'ab'), 2)
+        self.assertEqual(f.write(bytearray(b'cd')), 2)
+        self.assertEqual(f.write(memoryview(b'xefx')[1:3]), 2)
+        self.assertEqual(f.write(QByteArray(b'gh')), 2)
+        f.seek(0)
+        self.assertEqual(f.readAll(), QByteArray(b'abcdefgh'))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -39,7 +39,7 @@ sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from init_paths import init_test_paths
 init_test_paths(False)
 
-from PySide6.QtCore import QJsonDocument
+from PySide6.QtCore import QByteArray, QCryptographicHash, QJsonDocument
 
 
 class QJsonDocumentTest(unittest.TestCase):
@@ -53,6 +53,29 @@ class QJsonDocumentTest(unittest.TestCase):
         self.assertIsInstance(b, QJsonDocument)
         self.assertEqual(str(b.toVariant()), "{'test': [None]}")
 
+    def testFromBuffer(self):
+        '''The data of bytes/bytearray is borrowed and must not be retained'''
+        data = bytearray(b'{"key": "value", "list": [1, 2]}')
+        doc = QJsonDocument.fromJson(data)
+        data[9:14] = b'xxxxx'
+        del data
+        self.assertEqual(doc.toVariant(), {'key': 'value', 'list': [1, 2]})
+        doc = QJsonDocument.fromJson(QByteArray(b'[1]'))
+        self.assertEqual(doc.toVariant(), [1])
+        # The bytearray can be resized again after the call
+        data = bytearray(b'[]')
+        QJsonDocument.fromJson(data)
+        data.extend(b'x')
+        self.assertEqual(data, b'[]x')
+
+    def testCryptographicHashFromBuffer(self):
+        payload = b'x' * 100000
+        expected = QCryptographicHash.hash(QByteArray(payload), QCryptographicHash.Sha256)
+        self.assertEqual(QCryptographicHash.hash(payload, QCryptographicHash.Sha256), expected)
+        hash = QCryptographicHash(QCryptographicHash.Sha256)
+        hash.addData(bytearray(payload))
+        self.assertEqual(hash.result(), expected)
+
 
 if __name__ == '__main__':
     unittest.main()
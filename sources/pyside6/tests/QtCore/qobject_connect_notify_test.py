@@ -50,20 +50,20 @@ def cute_slot():
 class Obj(QObject):
     def __init__(self):
         super().__init__()
-        self.con_notified = False
-        self.dis_notified = False
+        self.con_notified = 0
+        self.dis_notified = 0
         self.signal = ""
 
     def connectNotify(self, signal):
-        self.con_notified = True
+        self.con_notified += 1
         self.signal = signal
 
     def disconnectNotify(self, signal):
-        self.dis_notified = True
+        self.dis_notified += 1
 
     def reset(self):
-        self.con_notified = False
-        self.dis_notified = False
+        self.con_notified = 0
+        self.dis_notified = 0
 
 
 class TestQObjectConnectNotify(UsesQCoreApplication):
@@ -79,37 +79,47 @@ class TestQObjectConnectNotify(UsesQCoreApplication):
         sender = Obj()
         receiver = QObject()
         sender.connect(SIGNAL("destroyed()"), receiver, SLOT("deleteLater()"))
-        self.assertTrue(sender.con_notified)
+        self.assertEqual(sender.con_notified, 1)
         # When connecting to a regular slot, and not a python callback function, QObject::connect
         # will use the non-cloned method signature, so connecting to destroyed() will actually
         # connect to destroyed(QObject*).
         self.assertEqual(sender.signal.methodSignature(), "destroyed(QObject*)")
         sender.disconnect(SIGNAL("destroyed()"), receiver, SLOT("deleteLater()"))
-        self.assertTrue(sender.dis_notified)
+        self.assertEqual(sender.dis_notified, 1)
 
     def testPySignal(self):
         sender = Obj()
         receiver = QObject()
         sender.connect(SIGNAL("foo()"), receiver, SLOT("deleteLater()"))
-        self.assertTrue(sender.con_notified)
+        self.assertEqual(sender.con_notified, 1)
         sender.disconnect(SIGNAL("foo()"), receiver, SLOT("deleteLater()"))
-        self.assertTrue(sender.dis_notified)
+        self.assertEqual(sender.dis_notified, 1)
 
     def testPySlots(self):
         sender = Obj()
         receiver = QObject()
         sender.connect(SIGNAL("destroyed()"), cute_slot)
-        self.assertTrue(sender.con_notified)
+        self.assertEqual(sender.con_notified, 1)
         sender.disconnect(SIGNAL("destroyed()"), cute_slot)
-        self.assertTrue(sender.dis_notified)
+        self.assertEqual(sender.dis_notified, 1)
 
     def testpyAll(self):
         sender = Obj()
         receiver = QObject()
         sender.connect(SIGNAL("foo()"), cute_slot)
-        self.assertTrue(sender.con_notified)
+        self.assertEqual(sender.con_notified, 1)
         sender.disconnect(SIGNAL("foo()"), cute_slot)
-        self.assertTrue(sender.dis_notified)
+        self.assertEqual(sender.dis_notified, 1)
+
+    def testConnectionCount(self):
+        sender = Obj()
+        receivers = [lambda: None for i in range(3)]
+        for receiver in receivers:
+            sender.connect(SIGNAL("foo()"), receiver)
+        self.assertEqual(sender.con_notified, 3)
+        for receiver in receivers:
+            sender.disconnect(SIGNAL("foo()"), receiver)
+        self.assertEqual(sender.dis_notified, 3)
 
 
 if __name__ == '__main__':
@@ -28,6 +28,7 @@
 
 '''Test cases for QObject property and setProperty'''
 
+import array
 import os
 import sys
 import unittest
@@ -39,6 +40,12 @@ init_test_paths(False)
 
 from PySide6.QtCore import QObject, Property, Signal
 
+try:
+    import numpy as np
+    have_numpy = True
+except ImportError:
+    have_numpy = False
+
 
 class MyObjectWithNotifyProperty(QObject):
     def __init__(self, parent=None):
@@ -73,6 +80,57 @@ class PropertyWithNotify(unittest.TestCase):
         self.assertEqual(o.myProperty, 10)
         self.assertEqual(o.property("myProperty"), 10)
 
+    def testRepeatedMetaCall(self):
+        # The converter of the property type is resolved once and reused
+        o = MyObjectWithNotifyProperty()
+        for i in range(100):
+            o.setProperty("myProperty", i)
+            self.assertEqual(o.property("myProperty"), i)
+        self.assertEqual(o.myProperty, 99)
+
+    def testDynamicPropertyContainers(self):
+        '''Lists and dicts are converted to QVariantList/QStringList/QVariantMap'''
+        o = QObject()
+        values = {
+            'floats': [float(i) / 2 for i in range(1000)],
+            'ints': [1, -2, 2**40, -2**63],
+            'mixed': [1, 2.5, 'three', True, None, [4]],
+            'strings': ['a', 'b\u20ac', ''],
+            'empty': [],
+            'map': {'a': 1, 'b': [1.5, 'x'], 'c': {'d': False}}
+        }
+        for name, value in values.items():
+            o.setProperty(name, value)
+            self.assertEqual(o.property(name), value)
+
+        # Dicts with non-string keys are wrapped
+        value = {1: 'a'}
+        o.setProperty('wrapped', value)
+        self.assertIs(o.property('wrapped'), value)
+
+    def testDynamicPropertyNumberLists(self):
+        o = QObject()
+        for value in ([0.5, 1.5], [1, -2, 2**31 - 1], [1, 2**40], [1, 2.5, True]):
+            o.setProperty('list', value)
+            result = o.property('list')
+            self.assertEqual(result, value)
+            self.assertEqual([type(v) for v in result], [type(v) for v in value])
+
+    def testDynamicPropertyBuffers(self):
+        '''Buffers are stored as the Python object itself'''
+        o = QObject()
+        for value in (array.array('d', [0.5, 1.5]),
+                      memoryview(array.array('q', [1, -2, 3]))[::2]):
+            o.setProperty('buffer', value)
+            self.assertIs(o.property('buffer'), value)
+
+    @unittest.skipUnless(have_numpy, "requires numpy")
+    def testDynamicPropertyNumpyArray(self):
+        o = QObject()
+        value = np.arange(4, dtype=np.int32)
+        o.setProperty('array', value)
+        self.assertIs(o.property('array'), value)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -38,6 +38,7 @@ from init_paths import init_test_paths
 init_test_paths(False)
 
 from PySide6.QtCore import QPoint, QPointF
+from shiboken6 import Shiboken
 
 
 class QPointTest(unittest.TestCase):
@@ -45,12 +46,34 @@ class QPointTest(unittest.TestCase):
     def testQPointCtor(self):
         point = QPoint(QPoint(10, 20))
 
+    @unittest.skipUnless(hasattr(sys, "getrefcount"), f"{sys.implementation.name} has no refcount")
+    def testInstancePool(self):
+        '''The C++ instance of a deleted temporary is reused (instance-pool-size).'''
+        one = QPoint(1, 1)
+        temporary = one * 2
+        address = Shiboken.getCppPointer(temporary)[0]
+        del temporary
+        point = one * 3
+        self.assertEqual(Shiboken.getCppPointer(point)[0], address)
+        self.assertEqual(point, QPoint(3, 3))
+
 
 class QPointFTest(unittest.TestCase):
 
     def testQPointFCtor(self):
         pointf = QPointF(QPoint(10, 20))
 
+    @unittest.skipUnless(hasattr(sys, "getrefcount"), f"{sys.implementation.name} has no refcount")
+    def testInstancePool(self):
+        '''The C++ instance of a deleted temporary is reused (instance-pool-size).'''
+        half = QPointF(0.5, 0.5)
+        temporary = half * 2
+        address = Shiboken.getCppPointer(temporary)[0]
+        del temporary
+        point = half * 3
+        self.assertEqual(Shiboken.getCppPointer(point)[0], address)
+        self.assertEqual(point, QPointF(1.5, 1.5))
+
 
 if __name__ == '__main__':
     unittest.main()
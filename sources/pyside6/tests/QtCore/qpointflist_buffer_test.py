@@ -0,0 +1,75 @@
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for the buffer protocol of the QPointFList and QIntList opaque containers'''
+
+import array
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QIntList, QPointF, QPointFList
+
+
+class QPointFListBufferTest(unittest.TestCase):
+
+    def testMemoryView(self):
+        points = QPointFList()
+        points.append(QPointF(1, 2))
+        points.append(QPointF(3, 4))
+        with memoryview(points) as view:
+            self.assertEqual(view.shape, (2, 2))
+            self.assertEqual(view.tolist(), [[1.0, 2.0], [3.0, 4.0]])
+            view[1, 0] = 5
+        self.assertEqual(points[1], QPointF(5, 4))
+
+    def testBulkCopy(self):
+        points = QPointFList()
+        points.extend(array.array('d', range(2000)))
+        self.assertEqual(len(points), 1000)
+        self.assertEqual(points[-1], QPointF(1998, 1999))
+        points[0:2] = [QPointF(-1, -1)]
+        self.assertEqual(len(points), 999)
+        self.assertEqual(points[0], QPointF(-1, -1))
+
+    def testIntList(self):
+        values = QIntList()
+        values.assign(array.array('i', range(10)))
+        with memoryview(values) as view:
+            self.assertEqual(view.format, 'i')
+            self.assertEqual(view.tolist(), list(range(10)))
+        self.assertEqual(list(values[::3]), [0, 3, 6, 9])
+
+
+if __name__ == '__main__':
+    unittest.main()
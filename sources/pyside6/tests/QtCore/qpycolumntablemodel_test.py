@@ -0,0 +1,124 @@
+# -*- coding: utf-8 -*-
+
+#############################################################################
+##
+## Copyright (C) 2022 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+'''Test cases for QPyColumnTableModel'''
+
+from array import array
+
+from PySide6.QtCore import QPyColumnTableModel, Qt
+
+
+class CustomRoleModel(QPyColumnTableModel):
+    def customData(self, index, role):
+        return f"{role}:{index.row()},{index.column()}"
+
+
+class QPyColumnTableModelTest(unittest.TestCase):
+
+    def testColumns(self):
+        model = QPyColumnTableModel()
+        model.addColumn(array('d', [1.5, -2.0, 3.25]), "Price")
+        model.addColumn(array('q', [2**40, -7]), "Quantity")
+        model.addColumn(["EUR", "USD", None], "Currency")
+        self.assertEqual(model.rowCount(), 3)
+        self.assertEqual(model.columnCount(), 3)
+
+        self.assertEqual(model.data(model.index(0, 0), Qt.DisplayRole), "1.5")
+        self.assertEqual(model.data(model.index(2, 0), Qt.EditRole), 3.25)
+        self.assertEqual(model.data(model.index(0, 1), Qt.DisplayRole), str(2**40))
+        self.assertEqual(model.data(model.index(1, 1), Qt.EditRole), -7)
+        self.assertEqual(model.data(model.index(1, 2), Qt.DisplayRole), "USD")
+        self.assertEqual(model.data(model.index(2, 2), Qt.DisplayRole), "")
+        # The quantity column is shorter than the others
+        self.assertIsNone(model.data(model.index(2, 1), Qt.DisplayRole))
+        self.assertIsNone(model.data(model.index(0, 0), Qt.DecorationRole))
+
+        self.assertEqual(model.headerData(1, Qt.Horizontal, Qt.DisplayRole), "Quantity")
+        self.assertEqual(model.headerData(0, Qt.Vertical, Qt.DisplayRole), 1)
+
+    def testColumnFormat(self):
+        model = QPyColumnTableModel()
+        model.addColumn(array('f', [0.5, 2.0]))
+        model.addColumn(array('i', [3]))
+        model.setColumnFormat(0, 'f', 2)
+        model.setColumnFormat(1, 'e', 1)
+        self.assertEqual(model.data(model.index(0, 0), Qt.DisplayRole), "0.50")
+        self.assertEqual(model.data(model.index(0, 1), Qt.DisplayRole), "3.0e+00")
+        self.assertEqual(model.data(model.index(1, 0), Qt.EditRole), 2.0)
+
+    def testStridedBuffer(self):
+        model = QPyColumnTableModel()
+        model.addColumn(memoryview(array('h', [1, 2, 3, 4, 5]))[::2])
+        model.addColumn(memoryview(bytes([1, 0])).cast('?'))
+        self.assertEqual(model.rowCount(), 3)
+        self.assertEqual(model.data(model.index(2, 0), Qt.EditRole), 5)
+        self.assertEqual(model.data(model.index(0, 1), Qt.EditRole), True)
+        self.assertEqual(model.data(model.index(1, 1), Qt.EditRole), False)
+
+    def testCustomRoles(self):
+        model = CustomRoleModel()
+        model.addColumn(array('i', [1, 2]))
+        toolTipRole = int(Qt.ToolTipRole)
+        model.setCustomRoles([toolTipRole, int(Qt.UserRole) + 1])
+        self.assertEqual(model.customRoles(), [toolTipRole, int(Qt.UserRole) + 1])
+        self.assertEqual(model.data(model.index(1, 0), Qt.ToolTipRole),
+                         f"{toolTipRole}:1,0")
+        self.assertEqual(model.data(model.index(1, 0), Qt.DisplayRole), "2")
+        self.assertIsNone(model.data(model.index(1, 0), Qt.StatusTipRole))
+
+    def testBufferExport(self):
+        column = array('i', [1, 2])
+        model = QPyColumnTableModel()
+        model.addColumn(column)
+        # The buffer is exported as long as the model references it
+        self.assertRaises(BufferError, column.append, 3)
+        model.clear()
+        self.assertEqual(model.rowCount(), 0)
+        column.append(3)
+        self.assertEqual(len(column), 3)
+
+    def testUnsupportedColumn(self):
+        model = QPyColumnTableModel()
+        self.assertRaises(TypeError, model.addColumn, 42)
+        self.assertRaises(TypeError, model.addColumn, "abc")
+        self.assertEqual(model.columnCount(), 0)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -28,6 +28,7 @@
 
 '''Test cases for QDate'''
 
+import array
 import gc
 import os
 import sys
@@ -133,6 +134,56 @@ class TestQSettings(unittest.TestCase):
         r = settings.value('lala', 22, type=float)
         self.assertEqual(type(r), float)
 
+    def testPyObjectSerialization(self):
+        """Python objects are streamed in a binary encoding with a fallback
+           to pickle for other objects."""
+        temp_dir = QDir.tempPath()
+        dir = QTemporaryDir(f'{temp_dir}/qsettings_XXXXXX')
+        self.assertTrue(dir.isValid())
+        file_name = dir.filePath('pyobject.ini')
+        binary = {'none': None, 'flag': True, 'int': -(2 ** 40), 'float': 1.5,
+                  'str': 'h\u00e9llo', 'bytes': b'\x00\xff',
+                  'list': [1, 'a', (2.5, b'b')], 7: {'nested': []}}
+        pickled = {'big': 2 ** 70, 'set': {1, 2}, 'list': [1, 2]}
+        settings = QSettings(file_name, QSettings.IniFormat)
+        settings.setValue('binary', binary)
+        settings.setValue('pickled', pickled)
+        settings.sync()
+        self.assertEqual(settings.status(), QSettings.NoError)
+        del settings
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+        settings = QSettings(file_name, QSettings.IniFormat)
+        self.assertEqual(settings.value('binary'), binary)
+        self.assertEqual(settings.value('pickled'), pickled)
+
+    def testNumberLists(self):
+        """Lists of floats and ints and numeric buffers are stored as typed
+           lists, which keep the type of the numbers."""
+        temp_dir = QDir.tempPath()
+        dir = QTemporaryDir(f'{temp_dir}/qsettings_XXXXXX')
+        self.assertTrue(dir.isValid())
+        file_name = dir.filePath('numbers.ini')
+        settings = QSettings(file_name, QSettings.IniFormat)
+        settings.setValue('doubles', [0.5, 1.5, -2.0])
+        settings.setValue('ints', [1, -2, 3])
+        settings.setValue('mixed', [1, 2.5])
+        settings.setValue('double_buffer', array.array('d', [0.5, 1.5]))
+        settings.setValue('int_buffer', memoryview(array.array('h', [1, -2, 3]))[::2])
+        settings.sync()
+        self.assertEqual(settings.status(), QSettings.NoError)
+        del settings
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+        settings = QSettings(file_name, QSettings.IniFormat)
+        self.assertEqual(settings.value('doubles'), [0.5, 1.5, -2.0])
+        self.assertEqual(settings.value('ints'), [1, -2, 3])
+        self.assertEqual(settings.value('double_buffer'), [0.5, 1.5])
+        self.assertEqual(settings.value('int_buffer'), [1, 3])
+        self.assertEqual(len(settings.value('mixed')), 2)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -40,6 +40,7 @@ from init_paths import init_test_paths
 init_test_paths(False)
 
 from PySide6.QtCore import QSize
+from shiboken6 import Shiboken
 
 
 class QSizeOperator(unittest.TestCase):
@@ -57,6 +58,17 @@ class QSizeOperator(unittest.TestCase):
         x = 3.4 * a
         self.assertEqual(QSize(3, 3), x)
 
+    @unittest.skipUnless(hasattr(sys, "getrefcount"), f"{sys.implementation.name} has no refcount")
+    def testInstancePool(self):
+        '''The C++ instance of a deleted temporary is reused (instance-pool-size).'''
+        a = QSize(1, 2)
+        temporary = a * 2
+        address = Shiboken.getCppPointer(temporary)[0]
+        del temporary
+        x = a.transposed()
+        self.assertEqual(Shiboken.getCppPointer(x)[0], address)
+        self.assertEqual(x, QSize(2, 1))
+
 
 if __name__ == '__main__':
     unittest.main()
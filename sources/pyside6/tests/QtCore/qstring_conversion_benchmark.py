@@ -0,0 +1,86 @@
+#############################################################################
+##
+## Copyright (C) 2022 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Measures the conversion of QString to Python strings.
+
+This is not part of the test suite. The number of conversions defaults to
+10^5 and can be set by the environment variable PYSIDE_QSTRING_CONVERSIONS.'''
+
+import os
+import sys
+import time
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QStringListModel, Qt
+
+
+# Strings of each representation (1, 2, 4 bytes per character)
+SAMPLES = {
+    'ascii': 'Display text 0123456789',
+    'latin-1': 'Caf\xe9 cr\xe8me br\xfbl\xe9e',
+    'bmp': 'Présentation € 中文',
+    'astral': 'Emoji \U0001F600 \U0001F680',
+}
+
+
+class QStringConversionBenchmark(unittest.TestCase):
+
+    def _measure(self, text):
+        count = int(os.environ.get('PYSIDE_QSTRING_CONVERSIONS', 100000))
+        model = QStringListModel([text] * 100)
+        indexes = [model.index(row, 0) for row in range(100)]
+        role = Qt.DisplayRole
+        start = time.perf_counter()
+        for i in range(count // 100):
+            for index in indexes:
+                model.data(index, role)
+        single = time.perf_counter() - start
+
+        long_text = text * (100000 // len(text))
+        model = QStringListModel([long_text])
+        start = time.perf_counter()
+        for i in range(100):
+            result = model.stringList()
+        bulk = time.perf_counter() - start
+        self.assertEqual(result, [long_text])
+        return count / single, 100 * len(long_text) / bulk
+
+    def testConversion(self):
+        for kind, text in SAMPLES.items():
+            calls, chars = self._measure(text)
+            print(f"\n{kind}: {calls:.0f} data() calls/s, "
+                  f"{chars / 1e6:.0f} M characters/s in long strings", file=sys.stderr)
+
+
+if __name__ == '__main__':
+    unittest.main()
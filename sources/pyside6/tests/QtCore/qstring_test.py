@@ -40,7 +40,7 @@ sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from init_paths import init_test_paths
 init_test_paths(False)
 
-from PySide6.QtCore import QObject
+from PySide6.QtCore import QObject, QStringListModel
 
 
 class QStringConstructor(unittest.TestCase):
@@ -55,6 +55,19 @@ class QStringConstructor(unittest.TestCase):
         obj.setObjectName(None)
         self.assertEqual(obj.objectName(), '')
 
+    def testQStringToPython(self):
+        '''Strings of all kinds come back unchanged with the narrowest representation'''
+        strings = ['', 'ascii', 'caf\xe9', '\u20ac uro', 'smile \U0001F600', '\uffff']
+        model = QStringListModel(strings)
+        result = model.stringList()
+        self.assertEqual(result, strings)
+        for s in result:
+            self.assertEqual(s.isascii(), all(ord(c) < 0x80 for c in s))
+
+        obj = QObject()
+        obj.setObjectName('x' * 100000 + '\u0100')
+        self.assertEqual(obj.objectName(), 'x' * 100000 + '\u0100')
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,155 @@
+#!/usr/bin/python
+
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+import gc
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(True)
+
+from testbinding import retainedMetaObjectCount
+from PySide6.QtCore import ClassInfo, QMetaObject, QObject, SIGNAL, SLOT, Slot
+
+'''Tests that superseded meta objects of objects with dynamic signals and
+slots are freed once no meta call can use them.'''
+
+
+class Sender(QObject):
+    pass
+
+
+class Receiver(QObject):
+    def __init__(self):
+        super().__init__()
+        self.calls = 0
+        self.signalsToAdd = 0
+
+    def dynamicSlot(self):
+        self.calls += 1
+        # Rebuild the meta object while it is used by this call.
+        for i in range(self.signalsToAdd):
+            QObject.connect(self, SIGNAL(f"inFlightSignal{self.calls}_{i}()"),
+                            self, SLOT("dynamicSlot()"))
+
+
+class Base(QObject):
+    @Slot()
+    def baseSlot(self):
+        pass
+
+
+class Derived(Base):
+    @Slot()
+    def derivedSlot(self):
+        pass
+
+
+class MetaObjectReclamationTest(unittest.TestCase):
+
+    def tearDown(self):
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testRebuildsDoNotAccumulate(self):
+        sender = Sender()
+        receiver = Receiver()
+        for i in range(100):
+            QObject.connect(sender, SIGNAL(f"dynamicSignal{i}()"),
+                            receiver, SLOT("dynamicSlot()"))
+        # The current meta object and the last superseded one are kept.
+        self.assertEqual(retainedMetaObjectCount(sender), 2)
+        QMetaObject.invokeMethod(sender, "dynamicSignal42")
+        self.assertEqual(receiver.calls, 1)
+
+    def testRebuildsDuringMetaCall(self):
+        sender = Sender()
+        receiver = Receiver()
+        QObject.connect(sender, SIGNAL("trigger()"), receiver, SLOT("dynamicSlot()"))
+        receiver.signalsToAdd = 10
+        QMetaObject.invokeMethod(sender, "trigger")
+        self.assertEqual(receiver.calls, 1)
+        # The meta objects superseded during the call could not be freed.
+        self.assertTrue(retainedMetaObjectCount(receiver) > 2)
+
+        receiver.signalsToAdd = 0
+        QObject.connect(receiver, SIGNAL("afterCall()"), receiver, SLOT("dynamicSlot()"))
+        self.assertEqual(retainedMetaObjectCount(receiver), 2)
+        QMetaObject.invokeMethod(receiver, "afterCall")
+        self.assertEqual(receiver.calls, 2)
+        QMetaObject.invokeMethod(receiver, "inFlightSignal1_3")
+        self.assertEqual(receiver.calls, 3)
+
+    def testSubclassOfRebuiltClass(self):
+        derived = Derived()
+        base = Base()
+        for i in range(10):
+            ClassInfo(**{f"key{i}": "value"})(Base)
+            base.metaObject()  # Rebuild
+        gc.collect()
+        # The first meta object of Base is the super class of Derived's.
+        self.assertEqual(retainedMetaObjectCount(base), 3)
+        metaObject = derived.metaObject()
+        self.assertEqual(metaObject.className(), "Derived")
+        superClass = metaObject.superClass()
+        self.assertEqual(superClass.className(), "Base")
+        self.assertEqual(superClass.superClass().className(), "QObject")
+        self.assertTrue(metaObject.indexOfMethod("baseSlot()") >= 0)
+        self.assertTrue(metaObject.indexOfMethod("derivedSlot()") > metaObject.indexOfMethod("baseSlot()"))
+        self.assertEqual(metaObject.methodCount(), superClass.methodCount() + 1)
+
+    def testWrappersOfSupersededMetaObjects(self):
+        sender = Sender()
+        receiver = Receiver()
+        QObject.connect(sender, SIGNAL("firstSignal()"), receiver, SLOT("dynamicSlot()"))
+        metaObject = sender.metaObject()
+        method = metaObject.method(metaObject.indexOfMethod("firstSignal()"))
+        for i in range(10):
+            QObject.connect(sender, SIGNAL(f"dynamicSignal{i}()"),
+                            receiver, SLOT("dynamicSlot()"))
+        sender.metaObject()
+        gc.collect()
+        # The meta object referenced by the wrappers is kept.
+        self.assertEqual(retainedMetaObjectCount(sender), 3)
+        self.assertEqual(metaObject.className(), "Sender")
+        self.assertEqual(method.methodSignature().data(), b"firstSignal()")
+
+        del metaObject
+        del method
+        gc.collect()
+        QObject.connect(sender, SIGNAL("lastSignal()"), receiver, SLOT("dynamicSlot()"))
+        self.assertEqual(retainedMetaObjectCount(sender), 2)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,135 @@
+#!/usr/bin/python
+
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+import gc
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(True)
+
+from testbinding import TestObject, methodCacheStatistics, resetMethodCacheStatistics
+from PySide6.QtCore import QObject, Signal, Slot
+
+'''Tests the converter cache used when calling Python slots from Qt.'''
+
+
+class Receiver(QObject):
+    def __init__(self):
+        super().__init__()
+        self.values = []
+
+    @Slot(int)
+    def slot(self, value):
+        self.values.append(value)
+
+
+class DynamicReceiver(QObject):
+    def __init__(self):
+        super().__init__()
+        self.first_values = []
+        self.second_values = []
+
+    def first(self, value):
+        self.first_values.append(value)
+
+    def second(self, value):
+        self.second_values.append(value * 2)
+
+
+class Sender(QObject):
+    valueChanged = Signal(int)
+
+
+class MethodCacheTest(unittest.TestCase):
+
+    def tearDown(self):
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testCallableReceiver(self):
+        # Callables are connected by functor connections converting the
+        # arguments themselves, bypassing the cache.
+        obj = TestObject(42)
+        values = []
+        obj.idValue.connect(values.append)
+        resetMethodCacheStatistics()
+        for i in range(10):
+            obj.emitIdValueSignal()
+        self.assertEqual(values, [42] * 10)
+        hits, misses, size = methodCacheStatistics()
+        self.assertEqual(hits, 0)
+        self.assertEqual(misses, 0)
+
+    def testSlotReceiver(self):
+        sender = Sender()
+        receiver = Receiver()
+        sender.valueChanged.connect(receiver.slot)
+        resetMethodCacheStatistics()
+        for i in range(5):
+            sender.valueChanged.emit(i)
+        self.assertEqual(receiver.values, list(range(5)))
+        hits, misses, size = methodCacheStatistics()
+        self.assertTrue(misses <= 1)
+        self.assertEqual(hits + misses, 5)
+
+    def testDynamicSlotInvalidation(self):
+        # Connecting undecorated methods adds dynamic slots to the meta object
+        # of the receiver instance. Rebuilding it must drop the converters
+        # cached for the superseded meta object.
+        sender = Sender()
+        receiver = DynamicReceiver()
+        sender.valueChanged.connect(receiver.first)
+        sender.valueChanged.emit(1)
+        sender.valueChanged.emit(2)
+        self.assertEqual(receiver.first_values, [1, 2])
+
+        sender.valueChanged.connect(receiver.second)
+        resetMethodCacheStatistics()
+        sender.valueChanged.emit(3)
+        self.assertEqual(receiver.first_values, [1, 2, 3])
+        self.assertEqual(receiver.second_values, [6])
+        hits, misses, size = methodCacheStatistics()
+        self.assertEqual(hits, 0)
+        self.assertEqual(misses, 2)
+
+        sender.valueChanged.emit(4)
+        self.assertEqual(receiver.first_values, [1, 2, 3, 4])
+        self.assertEqual(receiver.second_values, [6, 8])
+        hits, misses, size = methodCacheStatistics()
+        self.assertEqual(hits, 2)
+        self.assertEqual(misses, 2)
+
+
+if __name__ == '__main__':
+    unittest.main()
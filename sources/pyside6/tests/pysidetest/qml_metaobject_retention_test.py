@@ -0,0 +1,111 @@
+#!/usr/bin/python
+
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Tests that meta objects of types registered with QML are not freed when
+they are superseded since QML keeps using them.'''
+
+import gc
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(True)
+
+from testbinding import retainedMetaObjectCount
+from PySide6.QtCore import (ClassInfo, Property, QCoreApplication, QMetaObject,
+                            QObject, QUrl, SIGNAL, SLOT)
+from PySide6.QtQml import QQmlComponent, QQmlEngine, qmlRegisterType
+
+
+class Counter(QObject):
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self._value = 0
+        self.calls = 0
+
+    def getValue(self):
+        return self._value
+
+    def setValue(self, value):
+        self._value = value
+
+    value = Property(int, getValue, setValue)
+
+    def dynamicSlot(self):
+        self.calls += 1
+
+
+class QmlMetaObjectRetentionTest(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.app = QCoreApplication.instance() or QCoreApplication([])
+        qmlRegisterType(Counter, "Retention", 1, 0, "Counter")
+
+    def tearDown(self):
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testRegisteredTypeRebuilds(self):
+        counter = Counter()
+        for i in range(2):
+            ClassInfo(**{f"key{i}": "value"})(Counter)
+            counter.metaObject()  # Rebuild
+        gc.collect()
+        # The registered meta object and its successors are all kept.
+        self.assertEqual(retainedMetaObjectCount(counter), 3)
+
+        engine = QQmlEngine()
+        component = QQmlComponent(engine)
+        component.setData(b"import Retention 1.0\nCounter { value: 42 }", QUrl())
+        obj = component.create()
+        self.assertIsNotNone(obj, component.errorString())
+        self.assertEqual(obj.property("value"), 42)
+        self.assertEqual(obj.metaObject().className(), "Counter")
+
+    def testInstanceRebuilds(self):
+        counter = Counter()
+        for i in range(2):
+            QObject.connect(counter, SIGNAL(f"dynamicSignal{i}()"),
+                            counter, SLOT("dynamicSlot()"))
+            counter.metaObject()  # Rebuild
+        QObject.connect(counter, SIGNAL("lastSignal()"), counter, SLOT("dynamicSlot()"))
+        gc.collect()
+        # The instance may be exposed to QML, so superseded meta objects are kept.
+        self.assertTrue(retainedMetaObjectCount(counter) > 2)
+        QMetaObject.invokeMethod(counter, "dynamicSignal0")
+        self.assertEqual(counter.calls, 1)
+
+
+if __name__ == '__main__':
+    unittest.main()
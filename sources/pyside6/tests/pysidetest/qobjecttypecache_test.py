@@ -0,0 +1,73 @@
+#!/usr/bin/python
+
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Tests the wrappers of QObjects of classes not exposed to Python.'''
+
+import gc
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(True)
+
+import shiboken6
+from testbinding import getHiddenObject
+from PySide6.QtCore import QCoreApplication, QEvent, QObject
+
+
+class QObjectTypeCacheTest(unittest.TestCase):
+
+    def tearDown(self):
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testBestMatchingType(self):
+        objects = [getHiddenObject() for i in range(100)]
+        for obj in objects:
+            self.assertIs(type(obj), QObject)
+            self.assertEqual(obj.metaObject().className(), "HiddenObject")
+        objects[-1].callMe()
+        self.assertTrue(objects[-1].wasCalled())
+
+    def testDeletedFromCpp(self):
+        # The wrapper is released when the object is deleted by C++.
+        app = QCoreApplication.instance() or QCoreApplication([])
+        obj = getHiddenObject()
+        self.assertTrue(shiboken6.isValid(obj))
+        obj.deleteLater()
+        QCoreApplication.sendPostedEvents(None, QEvent.DeferredDelete)
+        self.assertFalse(shiboken6.isValid(obj))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,91 @@
+#!/usr/bin/python
+
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Measures connecting and disconnecting signals to Python callables.
+
+This is not part of the test suite. The number of connections defaults to
+10^4 and can be set by the environment variable PYSIDE_CHURN_CONNECTIONS.'''
+
+import gc
+import os
+import sys
+import time
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QObject, Signal, SIGNAL
+
+
+class Sender(QObject):
+    valueChanged = Signal(int)
+
+
+class Listener:
+    def __init__(self):
+        self.values = []
+
+    def onValue(self, value):
+        self.values.append(value)
+
+
+class ConnectionChurnBenchmark(unittest.TestCase):
+
+    def testChurn(self):
+        count = int(os.environ.get('PYSIDE_CHURN_CONNECTIONS', 10000))
+        sender = Sender()
+        received = []
+        start = time.perf_counter()
+        for i in range(count):
+            callback = lambda v, i=i: received.append(i)
+            sender.valueChanged.connect(callback)
+            sender.valueChanged.disconnect(callback)
+        churn = time.perf_counter() - start
+        listeners = [Listener() for i in range(count)]
+        start = time.perf_counter()
+        for listener in listeners:
+            sender.valueChanged.connect(listener.onValue)
+        sender.valueChanged.emit(1)
+        del listener
+        del listeners
+        gc.collect()
+        release = time.perf_counter() - start
+        print(f"\nConnecting and disconnecting {count} lambdas: {churn:.4f}s, "
+              f"connecting {count} bound methods, emitting and releasing: {release:.4f}s",
+              file=sys.stderr)
+        self.assertEqual(received, [])
+        self.assertEqual(sender.receivers(SIGNAL("valueChanged(int)")), 0)
+
+
+if __name__ == '__main__':
+    unittest.main()
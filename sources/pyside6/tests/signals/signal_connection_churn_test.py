@@ -0,0 +1,138 @@
+#!/usr/bin/python
+
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test connections of signals to Python callables.'''
+
+import gc
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QObject, Signal, SIGNAL
+
+
+class Sender(QObject):
+    valueChanged = Signal(int)
+    pairChanged = Signal(int, str)
+
+
+class Listener:
+    def __init__(self):
+        self.values = []
+
+    def onValue(self, value):
+        self.values.append(value)
+
+
+class ConnectionChurnTest(unittest.TestCase):
+
+    def tearDown(self):
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testDisconnectOne(self):
+        sender = Sender()
+        received = []
+        callback = received.append
+        sender.valueChanged.connect(callback)
+        sender.valueChanged.connect(callback)
+        sender.valueChanged.emit(1)
+        self.assertEqual(received, [1, 1])
+        sender.valueChanged.disconnect(callback)
+        sender.valueChanged.emit(2)
+        self.assertEqual(received, [1, 1, 2])
+        sender.valueChanged.disconnect(callback)
+        sender.valueChanged.emit(3)
+        self.assertEqual(received, [1, 1, 2])
+        self.assertRaises(RuntimeError, sender.valueChanged.disconnect, callback)
+
+    def testFewerArguments(self):
+        sender = Sender()
+        received = []
+        sender.pairChanged.connect(lambda value: received.append(value))
+        sender.pairChanged.connect(lambda value, text: received.append(text))
+        sender.pairChanged.connect(lambda: received.append(None))
+        sender.pairChanged.emit(1, "one")
+        self.assertEqual(sorted(received, key=str), sorted([1, "one", None], key=str))
+
+    def testBoundMethodLifetime(self):
+        # The connection is removed when the instance of a bound method dies.
+        sender = Sender()
+        listener = Listener()
+        sender.valueChanged.connect(listener.onValue)
+        sender.valueChanged.emit(1)
+        self.assertEqual(listener.values, [1])
+        received = listener.values
+        del listener
+        gc.collect()
+        sender.valueChanged.emit(2)
+        self.assertEqual(received, [1])
+        self.assertEqual(sender.receivers(SIGNAL("valueChanged(int)")), 0)
+
+    def testDisconnectAll(self):
+        sender = Sender()
+        received = []
+        for i in range(10):
+            sender.valueChanged.connect(lambda v, i=i: received.append(i))
+        sender.valueChanged.disconnect()
+        sender.valueChanged.emit(1)
+        self.assertEqual(received, [])
+
+    def testChurn(self):
+        signal = SIGNAL("valueChanged(int)")
+        sender = Sender()
+        received = []
+        for i in range(100):
+            callback = lambda v, i=i: received.append(i)
+            sender.valueChanged.connect(callback)
+            self.assertEqual(sender.receivers(signal), 1)
+            sender.valueChanged.disconnect(callback)
+        sender.valueChanged.emit(0)
+        self.assertEqual(received, [])
+        self.assertEqual(sender.receivers(signal), 0)
+
+        listeners = [Listener() for i in range(100)]
+        for listener in listeners:
+            sender.valueChanged.connect(listener.onValue)
+        self.assertEqual(sender.receivers(signal), 100)
+        sender.valueChanged.emit(1)
+        self.assertTrue(all(listener.values == [1] for listener in listeners))
+        del listener
+        del listeners
+        gc.collect()
+        self.assertEqual(sender.receivers(signal), 0)
+
+if __name__ == '__main__':
+    unittest.main()
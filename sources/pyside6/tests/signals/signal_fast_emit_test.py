@@ -0,0 +1,102 @@
+#!/usr/bin/python
+
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test the direct emission path of SignalInstance.emit().'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QObject, QTimer, Signal
+from shiboken6 import Shiboken
+
+
+class Emitter(QObject):
+    progress = Signal(int)
+    message = Signal(str)
+    values = Signal(int, float, str, object)
+    noArgs = Signal()
+    overloaded = Signal((int,), (str,))
+
+
+class SignalFastEmitTest(unittest.TestCase):
+
+    def setUp(self):
+        self.emitter = Emitter()
+        self.received = []
+
+    def callback(self, *args):
+        self.received.append(args)
+
+    def testEmitArguments(self):
+        self.emitter.progress.connect(self.callback)
+        self.emitter.message.connect(self.callback)
+        self.emitter.values.connect(self.callback)
+        self.emitter.noArgs.connect(self.callback)
+        payload = {"key": [1, 2]}
+        for i in range(3):
+            self.emitter.progress.emit(i)
+        self.emitter.message.emit("text")
+        self.emitter.values.emit(1, 2.5, "x", payload)
+        self.emitter.noArgs.emit()
+        self.assertEqual(self.received, [(0,), (1,), (2,), ("text",),
+                                         (1, 2.5, "x", payload), ()])
+        self.assertIs(self.received[4][3], payload)
+
+    def testOverloaded(self):
+        self.emitter.overloaded[int].connect(self.callback)
+        self.emitter.overloaded[str].connect(self.callback)
+        self.emitter.overloaded[int].emit(1)
+        self.emitter.overloaded[str].emit("s")
+        self.assertEqual(self.received, [(1,), ("s",)])
+
+    def testCppSignal(self):
+        timer = QTimer()
+        timer.objectNameChanged.connect(self.callback)
+        timer.objectNameChanged.emit("name")
+        self.assertEqual(self.received, [("name",)])
+
+    def testWrongArgumentCount(self):
+        self.assertRaises(TypeError, self.emitter.progress.emit, 1, 2)
+        self.assertRaises(TypeError, self.emitter.progress.emit)
+
+    def testDeletedSource(self):
+        signal = self.emitter.progress
+        Shiboken.delete(self.emitter)
+        self.assertRaises(RuntimeError, signal.emit, 1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,78 @@
+#!/usr/bin/python
+
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Benchmark the construction of objects with many signals and the first
+access of their signal instances, which are bound lazily.
+
+This is not part of the test suite. The number of objects defaults to
+2000 and can be set by the environment variable PYSIDE_LAZY_SIGNAL_OBJECTS.'''
+
+import os
+import sys
+import time
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QObject, Signal
+
+
+def _make_class(name, base, count):
+    attributes = {f"{name.lower()}Signal{i}": Signal(int) for i in range(count)}
+    return type(name, (base,), attributes)
+
+
+Base = _make_class("Base", QObject, 10)
+Middle = _make_class("Middle", Base, 10)
+Derived = _make_class("Derived", Middle, 10)
+
+
+class SignalLazyBindingBenchmark(unittest.TestCase):
+
+    def testConstructionCost(self):
+        count = int(os.environ.get('PYSIDE_LAZY_SIGNAL_OBJECTS', 2000))
+        start = time.perf_counter()
+        objects = [Derived() for i in range(count)]
+        construction = time.perf_counter() - start
+        start = time.perf_counter()
+        for obj in objects:
+            for name in ("baseSignal0", "middleSignal0", "derivedSignal0"):
+                getattr(obj, name)
+        access = time.perf_counter() - start
+        print(f"\nConstruction of {count} objects with 30 signals: {construction:.4f}s, "
+              f"first access of 3 signals: {access:.4f}s", file=sys.stderr)
+        self.assertEqual(len(objects), count)
+
+
+if __name__ == '__main__':
+    unittest.main()
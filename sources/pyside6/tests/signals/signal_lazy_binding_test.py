@@ -0,0 +1,170 @@
+#!/usr/bin/python
+
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test lazy binding of signal instances to objects.'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QObject, Signal, SignalInstance
+
+
+def _make_class(name, base, count):
+    attributes = {f"{name.lower()}Signal{i}": Signal(int) for i in range(count)}
+    return type(name, (base,), attributes)
+
+
+Base = _make_class("Base", QObject, 10)
+Middle = _make_class("Middle", Base, 10)
+Derived = _make_class("Derived", Middle, 10)
+
+
+class Shadowing(QObject):
+    valueChanged = Signal(int)
+    renamed = Signal(str, name="renamedSignal")
+
+
+class Shadowed(Shadowing):
+    def valueChanged(self):
+        return "method"
+
+
+class Aliasing(QObject):
+    changed = Signal(int)
+    alias = changed
+
+
+class LateShadowing(QObject):
+    valueChanged = Signal(int)
+
+
+class LateShadowingMiddle(LateShadowing):
+    pass
+
+
+class LateShadowed(LateShadowingMiddle):
+    pass
+
+
+sharedSignal = Signal(int)
+
+
+class SharingFirst(QObject):
+    first = sharedSignal
+
+
+class SharingSecond(QObject):
+    second = sharedSignal
+
+
+class LazySignalBindingTest(unittest.TestCase):
+
+    def testInstanceIsCached(self):
+        obj = Derived()
+        self.assertTrue(isinstance(obj.baseSignal3, SignalInstance))
+        self.assertIs(obj.baseSignal3, obj.baseSignal3)
+        self.assertIs(obj.derivedSignal9, obj.derivedSignal9)
+        self.assertIsNot(obj.baseSignal3, Derived().baseSignal3)
+
+    def testEmission(self):
+        obj = Derived()
+        received = []
+        obj.middleSignal5.connect(received.append)
+        obj.middleSignal5.emit(5)
+        obj.baseSignal0.connect(received.append)
+        obj.baseSignal0.emit(0)
+        self.assertEqual(received, [5, 0])
+
+    def testRenamedSignal(self):
+        obj = Shadowing()
+        received = []
+        obj.renamed.connect(received.append)
+        obj.renamed.emit("x")
+        self.assertEqual(received, ["x"])
+        self.assertIs(obj.renamed, obj.renamed)
+
+    def testShadowedSignal(self):
+        # PYSIDE-1730: Signals hidden by homonymous methods are still bound.
+        obj = Shadowed()
+        self.assertTrue(isinstance(obj.valueChanged, SignalInstance))
+        received = []
+        obj.valueChanged.connect(received.append)
+        obj.valueChanged.emit(1)
+        self.assertEqual(received, [1])
+
+    def testSignalShadowedLater(self):
+        # Assigning a homonymous method to a base class after the first
+        # instance was created must be taken into account for new instances.
+        self.assertTrue(isinstance(LateShadowed().valueChanged, SignalInstance))
+        LateShadowingMiddle.valueChanged = lambda self: "method"
+        try:
+            obj = LateShadowed()
+            self.assertTrue(isinstance(obj.valueChanged, SignalInstance))
+            received = []
+            obj.valueChanged.connect(received.append)
+            obj.valueChanged.emit(1)
+            self.assertEqual(received, [1])
+        finally:
+            del LateShadowingMiddle.valueChanged
+        obj = LateShadowed()
+        self.assertTrue(isinstance(obj.valueChanged, SignalInstance))
+        self.assertIs(obj.valueChanged, obj.valueChanged)
+
+    def testAliasedSignal(self):
+        obj = Aliasing()
+        received = []
+        obj.alias.connect(received.append)
+        obj.changed.emit(1)
+        obj.alias.emit(2)
+        self.assertEqual(received, [1, 2])
+        self.assertIs(obj.alias, obj.alias)
+        self.assertIs(obj.changed, obj.changed)
+
+    def testSignalSharedByClasses(self):
+        # The attribute name cached for the first class must not be used
+        # for the second one.
+        first = SharingFirst()
+        second = SharingSecond()
+        for obj, name in ((first, "first"), (second, "second"), (first, "first")):
+            instance = getattr(obj, name)
+            self.assertTrue(isinstance(instance, SignalInstance))
+            self.assertIs(getattr(obj, name), instance)
+        self.assertFalse(hasattr(first, "second"))
+        self.assertFalse(hasattr(second, "first"))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -31,6 +31,7 @@
 #include "abstractmetalang.h"
 #include "abstractmetalang_helpers.h"
 #include "abstractmetatype.h"
+#include "cachelocker.h"
 #include <codemodel.h>
 #include "documentation.h"
 #include "exception.h"
@@ -45,15 +46,18 @@
 #include <QtCore/QDebug>
 #include <QtCore/QRegularExpression>
 
+#include <deque>
+
 // Cache FunctionModificationList in a flat list per class (0 for global
-// functions, or typically owner/implementing/declaring class.
+// functions, or typically owner/implementing/declaring class. A deque is
+// used since references to its entries stay valid when appending.
 struct ModificationCacheEntry
 {
      const AbstractMetaClass *klass;
      FunctionModificationList modifications;
 };
 
-using ModificationCache = QList<ModificationCacheEntry>;
+using ModificationCache = std::deque<ModificationCacheEntry>;
 
 class AbstractMetaFunctionPrivate
 {
@@ -506,6 +510,7 @@ QStringList AbstractMetaFunction::introspectionCompatibleSignatures(const QStrin
 
 QString AbstractMetaFunctionPrivate::signature() const
 {
+    CacheLocker locker;
     if (m_cachedSignature.isEmpty()) {
         m_cachedSignature = m_originalName;
 
@@ -945,6 +950,7 @@ QString AbstractMetaFunctionPrivate::formatMinimalSignature(const AbstractMetaFu
 
 QString AbstractMetaFunction::minimalSignature() const
 {
+    CacheLocker locker;
     if (d->m_cachedMinimalSignature.isEmpty())
         d->m_cachedMinimalSignature = d->formatMinimalSignature(this, false);
     return d->m_cachedMinimalSignature;
@@ -997,6 +1003,7 @@ const FunctionModificationList &
 {
     if (!m_addedFunction.isNull())
         return m_addedFunction->modifications;
+    CacheLocker locker;
     for (const auto &ce : m_modificationCache) {
         if (ce.klass == implementor)
             return ce.modifications;
@@ -1005,8 +1012,8 @@ const FunctionModificationList &
         ? AbstractMetaFunction::findGlobalModifications(q)
         : AbstractMetaFunction::findClassModifications(q, implementor);
 
-    m_modificationCache.append({implementor, modifications});
-    return m_modificationCache.constLast().modifications;
+    m_modificationCache.push_back({implementor, modifications});
+    return m_modificationCache.back().modifications;
 }
 
 const FunctionModificationList &
@@ -1019,6 +1026,7 @@ const FunctionModificationList &
 
 void AbstractMetaFunction::clearModificationsCache()
 {
+    CacheLocker locker;
     d->m_modificationCache.clear();
 }
 
@@ -1315,6 +1323,7 @@ bool AbstractMetaFunction::isVirtual() const
 
 QString AbstractMetaFunctionPrivate::modifiedName(const AbstractMetaFunction *q) const
 {
+    CacheLocker locker;
     if (m_cachedModifiedName.isEmpty()) {
         for (const auto &mod : q->modifications(q->implementingClass())) {
             if (mod.isRenameModifier()) {
@@ -1394,6 +1403,7 @@ void AbstractMetaFunction::setExceptionHandlingModification(TypeSystem::Exceptio
 
 int AbstractMetaFunctionPrivate::overloadNumber(const AbstractMetaFunction *q) const
 {
+    CacheLocker locker;
     if (m_cachedOverloadNumber == TypeSystem::OverloadNumberUnset) {
         m_cachedOverloadNumber = TypeSystem::OverloadNumberDefault;
         for (const auto &mod : q->modifications(q->implementingClass())) {
@@ -31,6 +31,7 @@
 #include "abstractmetaenum.h"
 #include "abstractmetafunction.h"
 #include "abstractmetafield.h"
+#include "cachelocker.h"
 #include "documentation.h"
 #include "messages.h"
 #include "modifications.h"
@@ -71,8 +72,7 @@ public:
           m_hasCloneOperator(false),
           m_isTypeDef(false),
           m_hasToStringCapability(false),
-          m_valueTypeWithCopyConstructorOnly(false),
-          m_hasCachedWrapper(false)
+          m_valueTypeWithCopyConstructorOnly(false)
     {
     }
 
@@ -109,7 +109,6 @@ public:
     uint m_isTypeDef : 1;
     uint m_hasToStringCapability : 1;
     uint m_valueTypeWithCopyConstructorOnly : 1;
-    mutable uint m_hasCachedWrapper : 1;
 
     Documentation m_doc;
 
@@ -134,6 +133,9 @@ public:
     SourceLocation m_sourceLocation;
     UsingMembers m_usingMembers;
 
+    // Not a bit field since it is written under a CacheLocker while the
+    // flags above are read concurrently.
+    mutable bool m_hasCachedWrapper = false;
     mutable AbstractMetaClass::CppWrapper m_cachedWrapper;
     AbstractMetaClass::Attributes m_attributes;
 
@@ -1059,6 +1061,7 @@ static AbstractMetaClass::CppWrapper determineCppWrapper(const AbstractMetaClass
 
 AbstractMetaClass::CppWrapper AbstractMetaClass::cppWrapper() const
 {
+    CacheLocker locker;
     if (!d->m_hasCachedWrapper) {
         d->m_cachedWrapper = determineCppWrapper(this);
         d->m_hasCachedWrapper = true;
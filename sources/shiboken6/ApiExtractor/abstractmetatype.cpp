@@ -29,6 +29,7 @@
 #include "abstractmetatype.h"
 #include "abstractmetabuilder.h"
 #include "abstractmetalang.h"
+#include "cachelocker.h"
 #include "messages.h"
 #include "typedatabase.h"
 #include "typesystem.h"
@@ -71,55 +72,55 @@ const QSet<QString> &AbstractMetaType::cppCharTypes()
 
 const QSet<QString> &AbstractMetaType::cppSignedIntTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result = {u"char"_qs, u"signed char"_qs, u"short"_qs, u"short int"_qs,
-                  u"signed short"_qs, u"signed short int"_qs,
-                  u"int"_qs, u"signed int"_qs,
-                  u"long"_qs, u"long int"_qs,
-                  u"signed long"_qs, u"signed long int"_qs,
-                  u"long long"_qs, u"long long int"_qs,
-                  u"signed long long int"_qs,
-                  u"ptrdiff_t"_qs};
-        result |= cppSignedCharTypes();
-    }
+    static const QSet<QString> result = [] {
+        QSet<QString> r = {u"char"_qs, u"signed char"_qs, u"short"_qs, u"short int"_qs,
+                           u"signed short"_qs, u"signed short int"_qs,
+                           u"int"_qs, u"signed int"_qs,
+                           u"long"_qs, u"long int"_qs,
+                           u"signed long"_qs, u"signed long int"_qs,
+                           u"long long"_qs, u"long long int"_qs,
+                           u"signed long long int"_qs,
+                           u"ptrdiff_t"_qs};
+        r |= cppSignedCharTypes();
+        return r;
+    }();
     return result;
 }
 
 const QSet<QString> &AbstractMetaType::cppUnsignedIntTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result = {u"unsigned short"_qs, u"unsigned short int"_qs,
-                  u"unsigned"_qs, u"unsigned int"_qs,
-                  u"unsigned long"_qs, u"unsigned long int"_qs,
-                  u"unsigned long long"_qs,
-                  u"unsigned long long int"_qs,
-                  u"size_t"_qs};
-        result |= cppUnsignedCharTypes();
-    }
+    static const QSet<QString> result = [] {
+        QSet<QString> r = {u"unsigned short"_qs, u"unsigned short int"_qs,
+                           u"unsigned"_qs, u"unsigned int"_qs,
+                           u"unsigned long"_qs, u"unsigned long int"_qs,
+                           u"unsigned long long"_qs,
+                           u"unsigned long long int"_qs,
+                           u"size_t"_qs};
+        r |= cppUnsignedCharTypes();
+        return r;
+    }();
     return result;
 }
 
 const QSet<QString> &AbstractMetaType::cppIntegralTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result |= cppSignedIntTypes();
-        result |= cppUnsignedIntTypes();
-        result.insert(u"bool"_qs);
-    }
+    static const QSet<QString> result = [] {
+        QSet<QString> r = cppSignedIntTypes();
+        r |= cppUnsignedIntTypes();
+        r.insert(u"bool"_qs);
+        return r;
+    }();
     return result;
 }
 
 const QSet<QString> &AbstractMetaType::cppPrimitiveTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result |= cppIntegralTypes();
-        result |= cppFloatTypes();
-        result.insert(u"wchar_t"_qs);
-    }
+    static const QSet<QString> result = [] {
+        QSet<QString> r = cppIntegralTypes();
+        r |= cppFloatTypes();
+        r.insert(u"wchar_t"_qs);
+        return r;
+    }();
     return result;
 }
 
@@ -451,6 +452,7 @@ void AbstractMetaType::setArrayElementType(const AbstractMetaType &t)
 QString AbstractMetaType::cppSignature() const
 {
     const AbstractMetaTypeData *cd = d.constData();
+    CacheLocker locker;
     if (cd->m_cachedCppSignature.isEmpty() || cd->m_signaturesDirty)
         cd->m_cachedCppSignature = formatSignature(false);
     return cd->m_cachedCppSignature;
@@ -461,6 +463,7 @@ QString AbstractMetaType::pythonSignature() const
     // PYSIDE-921: Handle container returntypes correctly.
     // This is now a clean reimplementation.
     const AbstractMetaTypeData *cd = d.constData();
+    CacheLocker locker;
     if (cd->m_cachedPythonSignature.isEmpty() || cd->m_signaturesDirty)
         cd->m_cachedPythonSignature = formatPythonSignature();
     return cd->m_cachedPythonSignature;
@@ -761,14 +764,14 @@ void AbstractMetaType::setViewOn(const AbstractMetaType &v)
 
 AbstractMetaType AbstractMetaType::createVoid()
 {
-    static QScopedPointer<AbstractMetaType> metaType;
-    if (metaType.isNull()) {
-        static const TypeEntry *voidTypeEntry = TypeDatabase::instance()->findType(QLatin1String("void"));
+    static const AbstractMetaType metaType = [] {
+        const TypeEntry *voidTypeEntry = TypeDatabase::instance()->findType(QLatin1String("void"));
         Q_ASSERT(voidTypeEntry);
-        metaType.reset(new AbstractMetaType(voidTypeEntry));
-        metaType->decideUsagePattern();
-    }
-    return *metaType.data();
+        AbstractMetaType result(voidTypeEntry);
+        result.decideUsagePattern();
+        return result;
+    }();
+    return metaType;
 }
 
 void AbstractMetaType::dereference(QString *type)
@@ -901,6 +904,7 @@ AbstractMetaType::fromString(QString typeSignature, QString *errorMessage)
     if (typeSignature.startsWith(QLatin1String("::")))
         typeSignature.remove(0, 2);
 
+    CacheLocker locker;
     auto &cache = *metaTypeFromStringCache();
     auto it = cache.find(typeSignature);
     if (it == cache.end()) {
@@ -921,6 +925,7 @@ AbstractMetaType AbstractMetaType::fromTypeEntry(const TypeEntry *typeEntry)
     QString typeName = typeEntry->qualifiedCppName();
     if (typeName.startsWith(QLatin1String("::")))
         typeName.remove(0, 2);
+    CacheLocker locker;
     auto &cache  = *metaTypeFromStringCache();
     auto it = cache.find(typeName);
     if (it != cache.end())
@@ -0,0 +1,62 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "cachelocker.h"
+
+#include <QtCore/QRecursiveMutex>
+
+static bool m_enabled = false;
+
+static QRecursiveMutex &cacheMutex()
+{
+    static QRecursiveMutex result;
+    return result;
+}
+
+CacheLocker::CacheLocker() : m_locked(m_enabled)
+{
+    if (m_locked)
+        cacheMutex().lock();
+}
+
+CacheLocker::~CacheLocker()
+{
+    if (m_locked)
+        cacheMutex().unlock();
+}
+
+bool CacheLocker::isEnabled()
+{
+    return m_enabled;
+}
+
+// Must not be called while other threads access the caches.
+void CacheLocker::setEnabled(bool e)
+{
+    m_enabled = e;
+}
@@ -0,0 +1,52 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef CACHELOCKER_H
+#define CACHELOCKER_H
+
+#include <QtCore/QtGlobal>
+
+// Serializes the lazily computed caches of the meta language classes and
+// type entries while code is generated from several threads. It is a no-op
+// unless enabled.
+class CacheLocker
+{
+public:
+    Q_DISABLE_COPY_MOVE(CacheLocker)
+
+    CacheLocker();
+    ~CacheLocker();
+
+    static bool isEnabled();
+    static void setEnabled(bool e);
+
+private:
+    const bool m_locked;
+};
+
+#endif // CACHELOCKER_H
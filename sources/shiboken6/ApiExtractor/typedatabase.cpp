@@ -137,10 +137,8 @@ using IntTypeNormalizationEntries = QList<IntTypeNormalizationEntry>;
 
 static const IntTypeNormalizationEntries &intTypeNormalizationEntries()
 {
-    static IntTypeNormalizationEntries result;
-    static bool firstTime = true;
-    if (firstTime) {
-        firstTime = false;
+    static const IntTypeNormalizationEntries result = [] {
+        IntTypeNormalizationEntries r;
         for (auto t : {"char", "short", "int", "long"}) {
             const QString intType = QLatin1String(t);
             if (!TypeDatabase::instance()->findType(QLatin1Char('u') + intType)) {
@@ -148,10 +146,11 @@ static const IntTypeNormalizationEntries &intTypeNormalizationEntries()
                 entry.replacement = QStringLiteral("unsigned ") + intType;
                 entry.regex.setPattern(QStringLiteral("\\bu") + intType + QStringLiteral("\\b"));
                 Q_ASSERT(entry.regex.isValid());
-                result.append(entry);
+                r.append(entry);
             }
         }
-    }
+        return r;
+    }();
     return result;
 }
 
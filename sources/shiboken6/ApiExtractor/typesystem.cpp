@@ -28,6 +28,7 @@
 
 #include "typesystem.h"
 #include "abstractmetatype.h"
+#include "cachelocker.h"
 #include "typedatabase.h"
 #include "modifications.h"
 #include "messages.h"
@@ -361,6 +362,7 @@ QString TypeEntry::name() const
 // ("std::__1::shared_ptr" -> "std::shared_ptr"
 QString TypeEntryPrivate::shortName() const
 {
+    CacheLocker locker;
     if (m_cachedShortName.isEmpty()) {
         QVarLengthArray<const TypeEntry *> parents;
         bool foundInlineNamespace = false;
@@ -449,6 +451,7 @@ QString TypeEntry::targetLangApiName() const
 
 QString TypeEntry::targetLangName() const
 {
+    CacheLocker locker;
     if (m_d->m_cachedTargetLangName.isEmpty())
         m_d->m_cachedTargetLangName = buildTargetLangName();
     return m_d->m_cachedTargetLangName;
@@ -547,6 +550,7 @@ TypeEntryPrivate *TypeEntry::d_func()
 
 QString TypeEntry::targetLangEntryName() const
 {
+    CacheLocker locker;
     if (m_d->m_cachedTargetLangEntryName.isEmpty()) {
         m_d->m_cachedTargetLangEntryName = targetLangName();
         const int lastDot = m_d->m_cachedTargetLangEntryName.lastIndexOf(QLatin1Char('.'));
@@ -1239,6 +1243,7 @@ public:
     ComplexTypeEntry::TypeFlags m_typeFlags;
     ComplexTypeEntry::CopyableFlag m_copyableFlag = ComplexTypeEntry::Unknown;
     QString m_hashFunction;
+    int m_instancePoolSize = 0;
 
     const ComplexTypeEntry* m_baseContainerType = nullptr;
     // For class functions
@@ -1473,6 +1478,18 @@ void ComplexTypeEntry::setHashFunction(const QString &hashFunction)
     d->m_hashFunction = hashFunction;
 }
 
+int ComplexTypeEntry::instancePoolSize() const
+{
+    S_D(const ComplexTypeEntry);
+    return d->m_instancePoolSize;
+}
+
+void ComplexTypeEntry::setInstancePoolSize(int s)
+{
+    S_D(ComplexTypeEntry);
+    d->m_instancePoolSize = s;
+}
+
 void ComplexTypeEntry::setBaseContainerType(const ComplexTypeEntry *baseContainer)
 {
     S_D(ComplexTypeEntry);
@@ -2291,6 +2308,8 @@ void ComplexTypeEntry::formatDebug(QDebug &debug) const
     FORMAT_NONEMPTY_STRING("polymorphicIdValue", d->m_polymorphicIdValue)
     FORMAT_NONEMPTY_STRING("targetType", d->m_targetType)
     FORMAT_NONEMPTY_STRING("hash", d->m_hashFunction)
+    if (d->m_instancePoolSize > 0)
+        debug << ", instancePoolSize=" << d->m_instancePoolSize;
     FORMAT_LIST_SIZE("addedFunctions", d->m_addedFunctions)
     formatList(debug, "functionMods", d->m_functionMods, ", ");
     FORMAT_LIST_SIZE("fieldMods", d->m_fieldMods)
@@ -609,6 +609,9 @@ public:
     QString hashFunction() const;
     void setHashFunction(const QString &hashFunction);
 
+    int instancePoolSize() const;
+    void setInstancePoolSize(int s);
+
     void setBaseContainerType(const ComplexTypeEntry *baseContainer);
 
     const ComplexTypeEntry *baseContainerType() const;
@@ -78,6 +78,7 @@ static inline QString generateAttribute() { return QStringLiteral("generate"); }
 static inline QString generateGetSetDefAttribute() { return QStringLiteral("generate-getsetdef"); }
 static inline QString genericClassAttribute() { return QStringLiteral("generic-class"); }
 static inline QString indexAttribute() { return QStringLiteral("index"); }
+static inline QString instancePoolSizeAttribute() { return QStringLiteral("instance-pool-size"); }
 static inline QString invalidateAfterUseAttribute() { return QStringLiteral("invalidate-after-use"); }
 static inline QString isNullAttribute() { return QStringLiteral("isNull"); }
 static inline QString locationAttribute() { return QStringLiteral("location"); }
@@ -1683,6 +1684,16 @@ void TypeSystemParser::applyComplexTypeAttributes(const ConditionalStreamReader
                       qPrintable(msgUnimplementedAttributeWarning(reader, name)));
         } else if (name == QLatin1String("hash-function")) {
             ctype->setHashFunction(attributes->takeAt(i).value().toString());
+        } else if (name == instancePoolSizeAttribute()) {
+            const auto attribute = attributes->takeAt(i);
+            bool ok;
+            const int size = attribute.value().toInt(&ok);
+            if (ok && size >= 0) {
+                ctype->setInstancePoolSize(size);
+            } else {
+                qCWarning(lcShiboken, "%s",
+                          qPrintable(msgInvalidAttributeValue(attribute)));
+            }
         } else if (name == forceAbstractAttribute()) {
             if (convertBoolean(attributes->takeAt(i).value(), forceAbstractAttribute(), false))
                 ctype->setTypeFlags(ctype->typeFlags() | ComplexTypeEntry::ForceAbstract);
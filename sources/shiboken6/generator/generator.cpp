@@ -38,16 +38,23 @@
 #include "reporthandler.h"
 #include "fileout.h"
 #include "apiextractor.h"
+#include "cachelocker.h"
 #include "typesystem.h"
 
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QThreadPool>
 #include <QDebug>
 #include <typedatabase.h>
 
+#include <exception>
+#include <memory>
+#include <vector>
+
 static const char ENABLE_PYSIDE_EXTENSIONS[] = "enable-pyside-extensions";
+static const char JOBS[] = "jobs";
 
 /**
  * DefaultValue is used for storing default values of types for which code is
@@ -181,6 +188,7 @@ struct Generator::GeneratorPrivate
     AbstractMetaClassCList m_invisibleTopNamespaces;
     bool m_hasPrivateClasses = false;
     bool m_usePySideExtensions = false;
+    int m_jobs = 1;
 };
 
 Generator::Generator() : m_d(new GeneratorPrivate)
@@ -360,14 +368,27 @@ Generator::OptionDescriptions Generator::options() const
     return {
         {QLatin1String(ENABLE_PYSIDE_EXTENSIONS),
          u"Enable PySide extensions, such as support for signal/slots,\n"
-          "use this if you are creating a binding for a Qt-based library."_qs}
+          "use this if you are creating a binding for a Qt-based library."_qs},
+        {QLatin1String(JOBS) + QLatin1String("=<number>"),
+         u"Number of threads used for generating the class wrappers (default 1)."_qs}
     };
 }
 
-bool Generator::handleOption(const QString & key, const QString & /* value */)
+bool Generator::handleOption(const QString & key, const QString & value)
 {
     if (key == QLatin1String(ENABLE_PYSIDE_EXTENSIONS))
         return ( m_d->m_usePySideExtensions = true);
+    if (key == QLatin1String(JOBS)) {
+        bool ok;
+        const int jobs = value.toInt(&ok);
+        if (!ok || jobs < 1) {
+            qCWarning(lcShiboken).noquote().nospace()
+                << "Invalid number of jobs \"" << value << "\", using 1.";
+            return true;
+        }
+        m_d->m_jobs = jobs;
+        return true;
+    }
     return false;
 }
 
@@ -476,15 +497,75 @@ GeneratorContext Generator::contextForSmartPointer(const AbstractMetaClass *c,
     return result;
 }
 
+// Generates the class files on a thread pool. The files are written
+// afterwards in class order, so that the output and messages are the same
+// as for the sequential generation.
+bool Generator::generateClassesConcurrently()
+{
+    struct Job
+    {
+        GeneratorContext context;
+        QString filePath;
+        std::unique_ptr<FileOut> fileOut;
+        std::exception_ptr exception;
+    };
+
+    std::vector<Job> jobs;
+    for (auto cls : m_d->api.classes()) {
+        if (!shouldGenerate(cls))
+            continue;
+        auto context = contextForClass(cls);
+        const QString fileName = fileNameForContext(context);
+        if (fileName.isEmpty())
+            continue;
+        const QString filePath = outputDirectory() + QLatin1Char('/')
+            + subDirectoryForClass(cls) + QLatin1Char('/') + fileName;
+        jobs.push_back({context, filePath, {}, {}});
+    }
+
+    CacheLocker::setEnabled(true);
+    QThreadPool pool;
+    pool.setMaxThreadCount(m_d->m_jobs);
+    for (auto &job : jobs) {
+        pool.start([this, &job] {
+            try {
+                job.fileOut.reset(new FileOut(job.filePath));
+                generateClass(job.fileOut->stream, job.context);
+            } catch (...) {
+                job.exception = std::current_exception();
+            }
+        });
+    }
+    pool.waitForDone();
+    CacheLocker::setEnabled(false);
+
+    for (auto &job : jobs) {
+        if (job.exception)
+            std::rethrow_exception(job.exception);
+        job.fileOut->done();
+    }
+    return true;
+}
+
 bool Generator::generate()
 {
+    // Determine this upfront since the class files include the private
+    // module header depending on it.
     for (auto cls : m_d->api.classes()) {
-        if (!generateFileForContext(contextForClass(cls)))
-            return false;
         if (shouldGenerate(cls) && cls->typeEntry()->isPrivate())
             m_d->m_hasPrivateClasses = true;
     }
 
+    if (m_d->m_jobs > 1 && supportsConcurrentGeneration()) {
+        if (!generateClassesConcurrently())
+            return false;
+    } else {
+        for (auto cls : m_d->api.classes()) {
+            if (!generateFileForContext(contextForClass(cls)))
+                return false;
+        }
+    }
+
     const auto smartPointers = m_d->api.smartPointers();
     for (const AbstractMetaType &type : qAsConst(m_d->instantiatedSmartPointers)) {
         const AbstractMetaClass *smartPointerClass =
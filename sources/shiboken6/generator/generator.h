@@ -267,6 +267,10 @@ protected:
     /// Generates a file for given AbstractMetaClass or AbstractMetaType (smart pointer case).
     bool generateFileForContext(const GeneratorContext &context);
 
+    /// Returns true if generateClass() may be called from several threads
+    /// at a time (--jobs option).
+    virtual bool supportsConcurrentGeneration() const { return false; }
+
     /// Returns the file base name for a smart pointer.
     static QString getFileNameBaseForSmartPointer(const AbstractMetaType &smartPointerType,
                                                   const AbstractMetaClass *smartPointer);
@@ -371,6 +375,7 @@ private:
     void collectInstantiatedContainersAndSmartPointers(const AbstractMetaFunctionCPtr &func);
     void collectInstantiatedContainersAndSmartPointers(const AbstractMetaClass *metaClass);
     void collectInstantiatedContainersAndSmartPointers();
+    bool generateClassesConcurrently();
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(Generator::Options)
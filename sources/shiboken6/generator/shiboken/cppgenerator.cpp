@@ -339,13 +339,19 @@ std::optional<AbstractMetaType>
     return {};
 }
 
-void CppGenerator::clearTpFuncs()
+// Special functions which go into type slots instead of the method table
+using TpFuncs = QHash<QString, QString>;
+
+static TpFuncs emptyTpFuncs()
 {
-    m_tpFuncs = {
-        {QLatin1String("__str__"), {}}, {QLatin1String("__str__"), {}},
-        {reprFunction(), {}}, {QLatin1String("__iter__"), {}},
-        {QLatin1String("__next__"), {}}
-    };
+    return {{QLatin1String("__str__"), {}}, {reprFunction(), {}},
+            {QLatin1String("__iter__"), {}}, {QLatin1String("__next__"), {}}};
+}
+
+static bool isTpFunction(const QString &name)
+{
+    static const TpFuncs names = emptyTpFuncs();
+    return names.contains(name);
 }
 
 // Prevent ELF symbol qt_version_tag from being generated into the source
@@ -822,9 +828,21 @@ void CppGenerator::generateClass(TextStream &s, const GeneratorContext &classCon
 
 void CppGenerator::writeCacheResetNative(TextStream &s, const GeneratorContext &classContext)
 {
-    s << "void " << classContext.wrapperName()
+    const QString wrapperName = classContext.wrapperName();
+    s << "void " << wrapperName
         << "::resetPyMethodCache()\n{\n" << indent
         << "std::fill_n(m_PyMethodCache, sizeof(m_PyMethodCache) / sizeof(m_PyMethodCache[0]), false);\n"
+        << "if (m_PyTypeMethodCache != nullptr) {\n" << indent
+        << "Shiboken::ObjectType::releaseOverrideCache(m_PyTypeMethodCache);\n"
+        << "m_PyTypeMethodCache = nullptr;\n" << outdent << "}\n"
+        << outdent << "}\n\n";
+
+    // PYSIDE-803: Share the cache of methods not overridden by the Python type.
+    s << "void " << wrapperName
+        << "::setPyTypeMethodCache(PyTypeObject *type)\n{\n" << indent
+        << "m_PyTypeMethodCache = Shiboken::ObjectType::acquireOverrideCache(type, &typeid("
+        << wrapperName << "),\n" << indent
+        << "int(sizeof(m_PyMethodCache) / sizeof(m_PyMethodCache[0])));\n" << outdent
         << outdent << "}\n\n";
 }
 
@@ -859,6 +877,8 @@ void CppGenerator::writeDestructorNative(TextStream &s,
     // kill pyobject
     s << R"(SbkObject *wrapper = Shiboken::BindingManager::instance().retrieveWrapper(this);
 Shiboken::Object::destroy(wrapper, this);
+if (m_PyTypeMethodCache != nullptr)
+    Shiboken::ObjectType::releaseOverrideCache(m_PyTypeMethodCache);
 )" << outdent << "}\n";
 }
 
@@ -1060,7 +1080,8 @@ void CppGenerator::writeVirtualMethodNative(TextStream &s,
     }
     // PYSIDE-803: Build a boolean cache for unused overrides
     const bool multi_line = func->isVoid() || !snips.isEmpty() || func->isAbstract();
-    s << "if (m_PyMethodCache[" << cacheIndex << "])" << (multi_line ? " {\n" : "\n");
+    s << "if (m_PyMethodCache[" << cacheIndex << "] || (m_PyTypeMethodCache != nullptr && m_PyTypeMethodCache["
+        << cacheIndex << "]))" << (multi_line ? " {\n" : "\n");
     {
         Indentation indentation(s);
         writeVirtualMethodCppCall(s, func, funcName, snips, lastArg, retType,
@@ -1092,11 +1113,16 @@ void CppGenerator::writeVirtualMethodNative(TextStream &s,
         s << "// This method belongs to a property.\n";
     s << "static const char *funcName = \"" << propStr << funcName << "\";\n"
         << "Shiboken::AutoDecRef " << PYTHON_OVERRIDE_VAR
-        << "(Shiboken::BindingManager::instance().getOverride(this, nameCache, funcName));\n"
+        << "(Shiboken::BindingManager::instance().getOverride(this, nameCache, funcName";
+    // The cache of the Python type is cleared when a class attribute is set,
+    // so it takes precedence over the cache of the instance.
+    if (useOverrideCaching(func->ownerClass())) {
+        s << ",\n" << indent << "m_PyTypeMethodCache != nullptr ? m_PyTypeMethodCache + "
+            << cacheIndex << " : m_PyMethodCache + " << cacheIndex << outdent;
+    }
+    s << "));\n"
         << "if (" << PYTHON_OVERRIDE_VAR << ".isNull()) {\n"
         << indent << "gil.release();\n";
-    if (useOverrideCaching(func->ownerClass()))
-        s << "m_PyMethodCache[" << cacheIndex << "] = true;\n";
     writeVirtualMethodCppCall(s, func, funcName, snips, lastArg, retType,
                               returnStatement);
     s << outdent << "}\n\n"; //WS
@@ -1441,6 +1467,18 @@ void CppGenerator::writeEnumConverterFunctions(TextStream &s, const TypeEntry *e
     writeIsPythonConvertibleToCppFunction(s, QLatin1String("number"), flagsTypeName, numberCondition);
 }
 
+// Returns the number of C++ instances of a value type kept for reuse by the
+// copy conversion ("instance-pool-size"), 0 if the type is not pooled.
+static int instancePoolSize(const GeneratorContext &context)
+{
+    if (context.forSmartPointer() || context.useWrapper())
+        return 0;
+    const AbstractMetaClass *metaClass = context.metaClass();
+    if (!metaClass->typeEntry()->isValue() || metaClass->hasPrivateDestructor())
+        return 0;
+    return metaClass->typeEntry()->instancePoolSize();
+}
+
 void CppGenerator::writeConverterFunctions(TextStream &s, const AbstractMetaClass *metaClass,
                                            const GeneratorContext &classContext) const
 {
@@ -1535,9 +1573,21 @@ return result;)";
         computedWrapperName = classContext.smartPointerWrapperName();
     }
 
-    c << "return Shiboken::Object::newObject(" << cpythonType
-        << ", new ::" << computedWrapperName << "(*reinterpret_cast<const "
-        << typeName << " *>(cppIn)), true, true);";
+    if (instancePoolSize(classContext) > 0) {
+        // Assign to a C++ instance left by a deleted wrapper if possible.
+        c << "auto *source = reinterpret_cast<const " << typeName << " *>(cppIn);\n"
+            << "if (auto *pooled = reinterpret_cast<::" << computedWrapperName
+            << " *>(Shiboken::ObjectType::takePooledInstance(" << cpythonType << "))) {\n"
+            << indent << "*pooled = *source;\n"
+            << "return Shiboken::Object::newRecyclableObject(" << cpythonType
+            << ", pooled);\n" << outdent << "}\n"
+            << "return Shiboken::Object::newRecyclableObject(" << cpythonType
+            << ", new ::" << computedWrapperName << "(*source));";
+    } else {
+        c << "return Shiboken::Object::newObject(" << cpythonType
+            << ", new ::" << computedWrapperName << "(*reinterpret_cast<const "
+            << typeName << " *>(cppIn)), true, true);";
+    }
     writeCppToPythonFunction(s, c.toString(), sourceTypeName, targetTypeName);
     s << '\n';
 
@@ -1900,7 +1950,8 @@ static const char *fullName = ")" << fullPythonFunctionName(rfunc, true)
             && !overloadData.pythonFunctionWrapperUsesListOfArguments()) {
             s << "(" << PYTHON_ARG << " == 0 ? 0 : 1);\n";
         } else {
-            writeArgumentsInitializer(s, overloadData, errorReturn);
+            writeArgumentsInitializer(s, overloadData, errorReturn,
+                                      usesFastcall(overloadData));
         }
     }
 }
@@ -1989,17 +2040,23 @@ void CppGenerator::writeConstructorWrapper(TextStream &s, const OverloadData &ov
     // (first "1") and the flag indicating that the Python wrapper holds an C++ wrapper
     // is marked as true (the second "1"). Otherwise the default values apply:
     // Python owns it and C++ wrapper is false.
-    if (shouldGenerateCppWrapper(overloadData.referenceFunction()->ownerClass()))
+    if (shouldGenerateCppWrapper(overloadData.referenceFunction()->ownerClass())) {
         s << "Shiboken::Object::setHasCppWrapper(sbkSelf, true);\n";
+        if (useOverrideCaching(metaClass)) {
+            s << "if (auto *wrapper = dynamic_cast<" << classContext.wrapperName()
+                << " *>(cptr))\n" << indent
+                << "wrapper->setPyTypeMethodCache(Py_TYPE(self));\n" << outdent;
+        }
+    }
     // Need to check if a wrapper for same pointer is already registered
     // Caused by bug PYSIDE-217, where deleted objects' wrappers are not released
-    s << "if (Shiboken::BindingManager::instance().hasWrapper(cptr)) {\n";
+    s << "if (auto *staleWrapper = Shiboken::BindingManager::instance().findOrRegisterWrapper(sbkSelf, cptr)) {\n";
     {
         Indentation indent(s);
-        s << "Shiboken::BindingManager::instance().releaseWrapper("
-             "Shiboken::BindingManager::instance().retrieveWrapper(cptr));\n";
+        s << "Shiboken::BindingManager::instance().releaseWrapper(staleWrapper);\n"
+            << "Shiboken::BindingManager::instance().registerWrapper(sbkSelf, cptr);\n";
     }
-    s << "}\nShiboken::BindingManager::instance().registerWrapper(sbkSelf, cptr);\n";
+    s << "}\n";
 
     // Create metaObject and register signal/slot
     bool errHandlerNeeded = overloadData.maxArgs() > 0;
@@ -2061,10 +2118,15 @@ void CppGenerator::writeMethodWrapper(TextStream &s, const OverloadData &overloa
     const auto rfunc = overloadData.referenceFunction();
 
     int maxArgs = overloadData.maxArgs();
+    const bool fastcall = usesFastcall(overloadData);
 
     s << "static PyObject *";
     s << cpythonFunctionName(rfunc) << "(PyObject *self";
-    if (maxArgs > 0) {
+    if (maxArgs > 0 && fastcall) {
+        s << ", PyObject *const *args, Py_ssize_t nargs";
+        if (overloadData.hasArgumentWithDefaultValue())
+            s << ", PyObject *kwnames";
+    } else if (maxArgs > 0) {
         s << ", PyObject *" << (overloadData.pythonFunctionWrapperUsesListOfArguments() ? "args" : PYTHON_ARG);
         if (overloadData.hasArgumentWithDefaultValue() || rfunc->isCallOperator())
             s << ", PyObject *kwds";
@@ -2160,16 +2222,16 @@ void CppGenerator::writeMethodWrapper(TextStream &s, const OverloadData &overloa
     }
 
     if (maxArgs > 0)
-        writeErrorSection(s, overloadData, ErrorReturn::Default);
+        writeErrorSection(s, overloadData, ErrorReturn::Default, fastcall);
 
     s<< outdent << "}\n\n";
 }
 
 void CppGenerator::writeArgumentsInitializer(TextStream &s, const OverloadData &overloadData,
-                                             ErrorReturn errorReturn)
+                                             ErrorReturn errorReturn, bool fastcall)
 {
     const auto rfunc = overloadData.referenceFunction();
-    s << "PyTuple_GET_SIZE(args);\n";
+    s << (fastcall ? "nargs;\n" : "PyTuple_GET_SIZE(args);\n");
     writeUnusedVariableCast(s, QLatin1String("numArgs"));
 
     int minArgs = overloadData.minArgs();
@@ -2195,6 +2257,13 @@ void CppGenerator::writeArgumentsInitializer(TextStream &s, const OverloadData &
 
     bool usesNamedArguments = overloadData.hasArgumentWithDefaultValue();
 
+    // Named argument resolution and injected code expect a keyword dictionary.
+    if (fastcall && usesNamedArguments) {
+        s << "Shiboken::AutoDecRef kwdsDict(Shiboken::fastcallKeywordsToDict(args, nargs, kwnames));\n"
+            << "if (kwdsDict.isNull() && PyErr_Occurred())\n" << indent << errorReturn << outdent
+            << "PyObject *kwds = kwdsDict.object();\n\n";
+    }
+
     s << "// invalid argument lengths\n";
     bool ownerClassIsQObject = rfunc->ownerClass() && rfunc->ownerClass()->isQObject() && rfunc->isConstructor();
     if (usesNamedArguments) {
@@ -2244,6 +2313,13 @@ void CppGenerator::writeArgumentsInitializer(TextStream &s, const OverloadData &
     else
         funcName = rfunc->name();
 
+    if (fastcall) {
+        s << "if (!Shiboken::unpackFastcallArguments(args, numArgs, \"" << funcName << "\", "
+            << (usesNamedArguments ? 0 : minArgs) << ", " << maxArgs << ", "
+            << PYTHON_ARGS << "))\n" << indent << errorReturn << outdent << '\n';
+        return;
+    }
+
     QString argsVar = overloadData.hasVarargs() ?  QLatin1String("nonvarargs") : QLatin1String("args");
     s << "if (!";
     if (usesNamedArguments) {
@@ -2357,11 +2433,19 @@ void CppGenerator::writeCppSelfDefinition(TextStream &s,
 }
 
 void CppGenerator::writeErrorSection(TextStream &s, const OverloadData &overloadData,
-                                     ErrorReturn errorReturn)
+                                     ErrorReturn errorReturn, bool fastcall)
 {
     const auto rfunc = overloadData.referenceFunction();
     s  << '\n' << cpythonFunctionName(rfunc) << "_TypeError:\n";
     Indentation indentation(s);
+    if (fastcall) {
+        // The argument tuple is only needed for the error message.
+        s << "{\n" << indent
+            << "Shiboken::AutoDecRef errArgs(Shiboken::fastcallArgumentsToTuple(args, nargs));\n"
+            << "Shiboken::setErrorAboutWrongArguments(errArgs, fullName, errInfo);\n"
+            << outdent << "}\n" << errorReturn;
+        return;
+    }
     QString argsVar = overloadData.pythonFunctionWrapperUsesListOfArguments()
         ? QLatin1String("args") : QLatin1String(PYTHON_ARG);
     s << "Shiboken::setErrorAboutWrongArguments(" << argsVar << ", fullName, errInfo);\n"
@@ -4391,14 +4475,14 @@ void CppGenerator::writeClassDefinition(TextStream &s,
         tp_getset = cpythonGettersSettersDefinitionName(metaClass);
 
     // search for special functions
-    clearTpFuncs();
+    TpFuncs tpFuncs = emptyTpFuncs();
     for (const auto &func : metaClass->functions()) {
-        if (m_tpFuncs.contains(func->name()))
-            m_tpFuncs[func->name()] = cpythonFunctionName(func);
+        if (tpFuncs.contains(func->name()))
+            tpFuncs[func->name()] = cpythonFunctionName(func);
     }
-    if (m_tpFuncs.value(reprFunction()).isEmpty()
+    if (tpFuncs.value(reprFunction()).isEmpty()
         && metaClass->hasToStringCapability()) {
-        m_tpFuncs[reprFunction()] = writeReprFunction(s,
+        tpFuncs[reprFunction()] = writeReprFunction(s,
                 classContext,
                 metaClass->toStringCapabilityIndirections());
     }
@@ -4436,17 +4520,17 @@ void CppGenerator::writeClassDefinition(TextStream &s,
         << "}\n\nstatic PyType_Slot " << className << "_slots[] = {\n" << indent
         << "{Py_tp_base,        nullptr}, // inserted by introduceWrapperType\n"
         << pyTypeSlotEntry("Py_tp_dealloc", tp_dealloc)
-        << pyTypeSlotEntry("Py_tp_repr", m_tpFuncs.value(reprFunction()))
+        << pyTypeSlotEntry("Py_tp_repr", tpFuncs.value(reprFunction()))
         << pyTypeSlotEntry("Py_tp_hash", tp_hash)
         << pyTypeSlotEntry("Py_tp_call", tp_call)
-        << pyTypeSlotEntry("Py_tp_str", m_tpFuncs.value(QLatin1String("__str__")))
+        << pyTypeSlotEntry("Py_tp_str", tpFuncs.value(QLatin1String("__str__")))
         << pyTypeSlotEntry("Py_tp_getattro", tp_getattro)
         << pyTypeSlotEntry("Py_tp_setattro", tp_setattro)
         << pyTypeSlotEntry("Py_tp_traverse", className + QLatin1String("_traverse"))
         << pyTypeSlotEntry("Py_tp_clear", className + QLatin1String("_clear"))
         << pyTypeSlotEntry("Py_tp_richcompare", tp_richcompare)
-        << pyTypeSlotEntry("Py_tp_iter", m_tpFuncs.value(QLatin1String("__iter__")))
-        << pyTypeSlotEntry("Py_tp_iternext", m_tpFuncs.value(QLatin1String("__next__")))
+        << pyTypeSlotEntry("Py_tp_iter", tpFuncs.value(QLatin1String("__iter__")))
+        << pyTypeSlotEntry("Py_tp_iternext", tpFuncs.value(QLatin1String("__next__")))
         << pyTypeSlotEntry("Py_tp_methods", className + QLatin1String("_methods"))
         << pyTypeSlotEntry("Py_tp_getset", tp_getset)
         << pyTypeSlotEntry("Py_tp_init", tp_init)
@@ -4794,11 +4878,11 @@ void CppGenerator::writeGetterFunction(TextStream &s,
             s << "}\n";
         }
         // Check if field wrapper has already been created.
-        s << "} else if (Shiboken::BindingManager::instance().hasWrapper(" << cppField << ")) {" << "\n";
+        s << "} else if (auto *existingWrapper = Shiboken::BindingManager::instance().retrieveWrapper("
+            << cppField << ")) {" << "\n";
         {
             Indentation indent(s);
-            s << "pyOut = reinterpret_cast<PyObject *>(Shiboken::BindingManager::instance().retrieveWrapper("
-                << cppField << "));" << "\n"
+            s << "pyOut = reinterpret_cast<PyObject *>(existingWrapper);" << "\n"
                 << "Py_IncRef(pyOut);" << "\n"
                 << "return pyOut;" << "\n";
         }
@@ -5165,6 +5249,17 @@ void CppGenerator::writeSmartPointerRichCompareFunction(TextStream &s,
     writeRichCompareFunctionFooter(s, baseName);
 }
 
+bool CppGenerator::usesFastcall(const OverloadData &overloadData) const
+{
+    if (!useFastcall() || !overloadData.pythonFunctionWrapperUsesListOfArguments()
+        || overloadData.hasVarargs()) {
+        return false;
+    }
+    const auto rfunc = overloadData.referenceFunction();
+    return !rfunc->isConstructor() && !rfunc->isCallOperator()
+        && !rfunc->isOperatorOverload() && !isTpFunction(rfunc->name());
+}
+
 QString CppGenerator::methodDefinitionParameters(const OverloadData &overloadData) const
 {
     const bool usePyArgs = overloadData.pythonFunctionWrapperUsesListOfArguments();
@@ -5181,6 +5276,10 @@ QString CppGenerator::methodDefinitionParameters(const OverloadData &overloadDat
             s << "METH_NOARGS";
         else
             s << "METH_O";
+    } else if (usesFastcall(overloadData)) {
+        s << "METH_FASTCALL";
+        if (overloadData.hasArgumentWithDefaultValue())
+            s << "|METH_KEYWORDS";
     } else {
         s << "METH_VARARGS";
         if (overloadData.hasArgumentWithDefaultValue())
@@ -5218,7 +5317,7 @@ void CppGenerator::writeMethodDefinition(TextStream &s,
                                          const OverloadData &overloadData) const
 {
     const auto func = overloadData.referenceFunction();
-    if (m_tpFuncs.contains(func->name()))
+    if (isTpFunction(func->name()))
         return;
 
     if (OverloadData::hasStaticAndInstanceFunctions(overloadData.overloads())) {
@@ -5362,12 +5461,12 @@ void CppGenerator::writeEnumInitialization(TextStream &s, const AbstractMetaEnum
             // We need 'flags->flagsName()' with the full module/class path.
             QString fullPath = getClassTargetFullName(cppEnum);
             fullPath.truncate(fullPath.lastIndexOf(QLatin1Char('.')) + 1);
-            s << cpythonTypeNameExt(flags) << " = PySide::QFlags::create(\""
+            s << cpythonTypeArrayEntry(flags) << " = PySide::QFlags::create(\""
                 << packageLevel << ':' << fullPath << flags->flagsName() << "\", "
                 << cpythonEnumName(cppEnum) << "_number_slots);\n";
         }
 
-        enumVarTypeObj = cpythonTypeNameExt(enumTypeEntry);
+        enumVarTypeObj = cpythonTypeArrayEntry(enumTypeEntry);
 
         s << enumVarTypeObj << " = Shiboken::Enum::"
             << ((enclosingClass || hasUpperEnclosingClass) ? "createScopedEnum" : "createGlobalEnum")
@@ -5378,10 +5477,10 @@ void CppGenerator::writeEnumInitialization(TextStream &s, const AbstractMetaEnum
                 << '"' << packageLevel << ':' << getClassTargetFullName(cppEnum) << "\",\n"
                 << '"' << cppEnum.qualifiedCppName() << '"';
             if (flags)
-                s << ",\n" << cpythonTypeNameExt(flags);
+                s << ",\n" << cpythonTypeArrayEntry(flags);
             s << ");\n";
         }
-        s << "if (!" << cpythonTypeNameExt(cppEnum.typeEntry()) << ")\n"
+        s << "if (!" << enumVarTypeObj << ")\n"
             << indent << errorReturn << outdent << '\n';
     }
 
@@ -5775,9 +5874,9 @@ void CppGenerator::writeClassRegister(TextStream &s,
                     << chopType(pyTypeName) << "_PropertyStrings);\n";
 
     if (!classContext.forSmartPointer())
-        s << cpythonTypeNameExt(classTypeEntry) << " = pyType;\n\n";
+        s << cpythonTypeArrayEntry(classTypeEntry) << " = pyType;\n\n";
     else
-        s << cpythonTypeNameExt(classContext.preciseType()) << " = pyType;\n\n";
+        s << cpythonTypeArrayEntry(classContext.preciseType()) << " = pyType;\n\n";
 
     // Register conversions for the type.
     writeConverterRegister(s, metaClass, classContext);
@@ -5813,6 +5912,11 @@ void CppGenerator::writeClassRegister(TextStream &s,
             << ", &" << cpythonBaseName(metaClass) << "_typeDiscovery);\n\n";
     }
 
+    if (const int poolSize = instancePoolSize(classContext); poolSize > 0) {
+        s << "Shiboken::ObjectType::setInstancePoolSize(" << cpythonTypeName(metaClass)
+            << ", " << poolSize << ");\n";
+    }
+
     AbstractMetaEnumList classEnums = metaClass->enums();
     metaClass->getEnumsFromInvisibleNamespacesToBeGenerated(&classEnums);
 
@@ -6057,14 +6161,13 @@ void CppGenerator::writeGetattroDefinition(TextStream &s, const AbstractMetaClas
 
 QString CppGenerator::qObjectGetAttroFunction() const
 {
-    static QString result;
-    if (result.isEmpty()) {
+    static const QString result = [this] {
         auto qobjectClass = AbstractMetaClass::findClass(api().classes(), qObjectT());
         Q_ASSERT(qobjectClass);
-        result = QLatin1String("PySide::getMetaDataFromQObject(")
-                 + cpythonWrapperCPtr(qobjectClass, QLatin1String("self"))
-                 + QLatin1String(", self, name)");
-    }
+        return QLatin1String("PySide::getMetaDataFromQObject(")
+               + cpythonWrapperCPtr(qobjectClass, QLatin1String("self"))
+               + QLatin1String(", self, name)");
+    }();
     return result;
 }
 
@@ -6241,6 +6344,41 @@ void CppGenerator::writeInitFunc(TextStream &declStr, TextStream &callStr,
     }
 }
 
+// Top level type created on first use along with its nested types
+// (option --lazy-init).
+struct LazyTypeGroup
+{
+    QString name; // Python name
+    QString functionName;
+    QStringList indexes;
+    QStringList cppNames;
+    QString body;
+};
+
+static void addLazyTypeNames(LazyTypeGroup *group, const AbstractMetaClass *metaClass)
+{
+    group->indexes.append(ShibokenGenerator::getTypeIndexVariableName(metaClass));
+    if (!metaClass->isNamespace()) {
+        QStringList lst = metaClass->qualifiedCppName().split(u"::"_qs, Qt::SkipEmptyParts);
+        for ( ; !lst.isEmpty(); lst.removeFirst())
+            group->cppNames.append(u'"' + lst.join(u"::"_qs) + u'"');
+        group->cppNames.append(u"typeid(::"_qs + metaClass->qualifiedCppName()
+                               + u").name()"_qs);
+    }
+    AbstractMetaEnumList enums;
+    metaClass->getEnumsToBeGenerated(&enums);
+    metaClass->getEnumsFromInvisibleNamespacesToBeGenerated(&enums);
+    for (const AbstractMetaEnum &metaEnum : qAsConst(enums)) {
+        if (metaEnum.isAnonymous())
+            continue;
+        const EnumTypeEntry *enumTypeEntry = metaEnum.typeEntry();
+        group->indexes.append(ShibokenGenerator::getTypeIndexVariableName(enumTypeEntry));
+        group->cppNames.append(u'"' + metaEnum.qualifiedCppName() + u'"');
+        if (const FlagsTypeEntry *flags = enumTypeEntry->flags())
+            group->indexes.append(ShibokenGenerator::getTypeIndexVariableName(flags));
+    }
+}
+
 bool CppGenerator::finishGeneration()
 {
     //Generate CPython wrapper file
@@ -6273,17 +6411,44 @@ bool CppGenerator::finishGeneration()
     }
 
     AbstractMetaClassCList classesWithStaticFields;
+    QList<LazyTypeGroup> lazyTypeGroups;
+    QHash<const TypeEntry *, qsizetype> lazyTypeGroupIndexes;
     for (auto cls : api().classes()){
-        if (shouldGenerate(cls)) {
+        if (!shouldGenerate(cls))
+            continue;
+        const TypeEntry *enclosingEntry = cls->typeEntry()->targetLangEnclosingEntry();
+        if (!useLazyInit()) {
             writeInitFunc(s_classInitDecl, s_classPythonDefines,
-                          getSimpleClassInitFunctionName(cls),
-                          cls->typeEntry()->targetLangEnclosingEntry());
+                          getSimpleClassInitFunctionName(cls), enclosingEntry);
             if (cls->hasStaticFields()) {
                 s_classInitDecl << "void "
                     << getSimpleClassStaticFieldsInitFunctionName(cls) << "();\n";
                 classesWithStaticFields.append(cls);
             }
+            continue;
+        }
+        // Nested classes are created by the function of their top level class.
+        auto groupIt = lazyTypeGroupIndexes.constFind(enclosingEntry);
+        if (groupIt == lazyTypeGroupIndexes.cend()) {
+            LazyTypeGroup group;
+            group.name = cls->typeEntry()->targetLangEntryName();
+            group.functionName = u"lazyInit_"_qs + getSimpleClassInitFunctionName(cls);
+            lazyTypeGroups.append(group);
+            groupIt = lazyTypeGroupIndexes.insert(cls->typeEntry(), lazyTypeGroups.size() - 1);
+        } else {
+            lazyTypeGroupIndexes.insert(cls->typeEntry(), groupIt.value());
         }
+        LazyTypeGroup &group = lazyTypeGroups[groupIt.value()];
+        StringStream callStr(TextStream::Language::Cpp);
+        writeInitFunc(s_classInitDecl, callStr, getSimpleClassInitFunctionName(cls),
+                      enclosingEntry);
+        if (cls->hasStaticFields()) {
+            const QString staticFieldsInit = getSimpleClassStaticFieldsInitFunctionName(cls);
+            s_classInitDecl << "void " << staticFieldsInit << "();\n";
+            callStr << staticFieldsInit << "();\n";
+        }
+        group.body += callStr.toString();
+        addLazyTypeNames(&group, cls);
     }
 
     // Initialize smart pointer types.
@@ -6314,6 +6479,14 @@ bool CppGenerator::finishGeneration()
     if (!instantiatedContainers().isEmpty())
         s << "#include <sbkcontainer.h>\n#include <sbkstaticstrings.h>\n";
 
+    if (useFastcall()) {
+        s << R"(
+#if !defined(Py_LIMITED_API) && PY_VERSION_HEX < 0x03070000
+#  error "METH_FASTCALL requires Python 3.7"
+#endif
+)";
+    }
+
     if (usePySideExtensions()) {
         s << includeQDebug;
         s << R"(#include <pysidecleanup.h>
@@ -6384,6 +6557,15 @@ bool CppGenerator::finishGeneration()
         << "------------------------------------------------------------\n"
         << s_classInitDecl.toString() << '\n';
 
+    if (!lazyTypeGroups.isEmpty()) {
+        s << "// Lazy type creation functions "
+            << "------------------------------------------------------------\n";
+        for (const LazyTypeGroup &group : qAsConst(lazyTypeGroups)) {
+            s << "static void " << group.functionName << "(PyObject *module)\n{\n"
+                << indent << group.body << outdent << "}\n\n";
+        }
+    }
+
     if (!globalEnums.isEmpty()) {
         StringStream convImpl(TextStream::Language::Cpp);
 
@@ -6520,12 +6702,40 @@ bool CppGenerator::finishGeneration()
         << "_CONVERTERS_IDX_COUNT" << "];\n"
         << convertersVariableName() << " = sbkConverters;\n\n"
         << "PyObject *module = Shiboken::Module::create(\""  << moduleName()
-        << "\", &moduledef);\n\n"
-        << "// Make module available from global scope\n"
+        << "\", &moduledef);\n\n";
+
+    if (useFastcall()) {
+        s << "#ifdef Py_LIMITED_API\n"
+            << "if (!PepRuntime_37_flag) {\n" << indent
+            << "Py_XDECREF(module);\n"
+            << "PyErr_SetString(PyExc_ImportError, \"" << moduleName()
+            << " uses METH_FASTCALL, which requires Python 3.7\");\n"
+            << "return nullptr;\n" << outdent
+            << "}\n#endif\n\n";
+    }
+
+    s << "// Make module available from global scope\n"
         << globalModuleVar << " = module;\n\n"
         << "// Initialize classes in the type system\n"
         << s_classPythonDefines.toString();
 
+    if (!lazyTypeGroups.isEmpty()) {
+        s << "// Register classes in the type system for creation on first use\n";
+        for (const LazyTypeGroup &group : qAsConst(lazyTypeGroups)) {
+            s << "{\n" << indent
+                << "static const int indexes[] = {" << group.indexes.join(u", "_qs)
+                << ", -1};\n"
+                << "const char *const cppNames[] = {";
+            for (const QString &cppName : group.cppNames)
+                s << cppName << ", ";
+            s << "nullptr};\n"
+                << "Shiboken::Module::addLazyType(module, " << cppApiVariableName()
+                << ", \"" << group.name << "\", " << group.functionName
+                << ", indexes, cppNames);\n"
+                << outdent << "}\n";
+        }
+    }
+
     if (!typeConversions.isEmpty()) {
         s << '\n';
         for (const CustomConversion *conversion : typeConversions) {
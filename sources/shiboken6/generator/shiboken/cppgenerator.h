@@ -129,7 +129,8 @@ private:
     void writeMethodWrapper(TextStream &s, const OverloadData &overloadData,
                             const GeneratorContext &classContext) const;
     static void writeArgumentsInitializer(TextStream &s, const OverloadData &overloadData,
-                                          ErrorReturn errorReturn = ErrorReturn::Default);
+                                          ErrorReturn errorReturn = ErrorReturn::Default,
+                                          bool fastcall = false);
     static void writeCppSelfConversion(TextStream &s,
                                        const GeneratorContext &context,
                                        const QString &className,
@@ -148,7 +149,7 @@ private:
                                 bool cppSelfAsReference = false) const;
 
     static void writeErrorSection(TextStream &s, const OverloadData &overloadData,
-                                  ErrorReturn errorReturn);
+                                  ErrorReturn errorReturn, bool fastcall = false);
     static void writeFunctionReturnErrorCheckSection(TextStream &s,
                                                      ErrorReturn errorReturn,
                                                      bool hasReturnValue = true);
@@ -349,6 +350,8 @@ private:
     void writeClassDefinition(TextStream &s,
                               const AbstractMetaClass *metaClass,
                               const GeneratorContext &classContext);
+    /// Returns whether the method wrapper uses the METH_FASTCALL calling convention.
+    bool usesFastcall(const OverloadData &overloadData) const;
     QString methodDefinitionParameters(const OverloadData &overloadData) const;
     void writeMethodDefinitionEntries(TextStream &s,
                                       const OverloadData &overloadData,
@@ -494,10 +497,6 @@ private:
     std::optional<AbstractMetaType>
         findSmartPointerInstantiation(const TypeEntry *entry) const;
 
-    void clearTpFuncs();
-
-    QHash<QString, QString> m_tpFuncs;
-
     static const char *PYTHON_TO_CPPCONVERSION_STRUCT;
 };
 
@@ -166,6 +166,8 @@ CppGenerator::OpaqueContainerData
     s << "static PyMethodDef " << methods << "[] = {\n" << indent;
     writeMethod(s, privateObjType, "push_back");
     writeMethod(s, privateObjType, "push_back", "append"); // Qt convention
+    writeMethod(s, privateObjType, "extend");
+    writeMethod(s, privateObjType, "assign");
     writeNoArgsMethod(s, privateObjType, "clear");
     writeNoArgsMethod(s, privateObjType, "pop_back");
     writeNoArgsMethod(s, privateObjType, "pop_back", "removeLast"); // Qt convention
@@ -189,6 +191,8 @@ CppGenerator::OpaqueContainerData
     writeSlot(s, privateObjType, "Py_sq_ass_item", "sqSetItem");
     writeSlot(s, privateObjType, "Py_sq_length", "sqLen");
     writeSlot(s, privateObjType, "Py_sq_item", "sqGetItem");
+    writeSlot(s, privateObjType, "Py_mp_subscript", "mpSubscript");
+    writeSlot(s, privateObjType, "Py_mp_ass_subscript", "mpAssSubscript");
     s << "{0, nullptr}\n" << outdent << "};\n\n";
 
     // spec
@@ -199,13 +203,16 @@ CppGenerator::OpaqueContainerData
         << "sizeof(ShibokenContainer),\n0,\nPy_TPFLAGS_DEFAULT,\n"
         <<  slotsList << outdent << "\n};\n\n";
 
-    // type creation function that sets a key in the type dict.
+    // type creation function that sets a key in the type dict and the
+    // buffer procedures for containers of contiguous, POD-like values.
     const QString typeCreationFName =  u"create"_qs + result.name + u"Type"_qs;
     s << "static inline PyTypeObject *" << typeCreationFName << "()\n{\n" << indent
         << "auto *result = reinterpret_cast<PyTypeObject *>(SbkType_FromSpec(&"
         << specName <<  "));\nPy_INCREF(Py_True);\n"
         << "PyDict_SetItem(result->tp_dict, "
            "Shiboken::PyMagicName::opaque_container(), Py_True);\n"
+        << "if (auto *bufferProcs = " << privateObjType << "::bufferProcs())\n"
+        << indent << "PepType_AS_BUFFER(result) = bufferProcs;\n" << outdent
         << "return result;\n" << outdent << "}\n\n";
 
     // typeF() function
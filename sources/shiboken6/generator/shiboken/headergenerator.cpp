@@ -83,7 +83,7 @@ void HeaderGenerator::generateClass(TextStream &s, const GeneratorContext &class
 {
     GeneratorContext classContext = classContextIn;
     const AbstractMetaClass *metaClass = classContext.metaClass();
-    m_inheritedOverloads.clear();
+    InheritedOverloads inheritedOverloads;
 
     // write license comment
     s << licenseComment();
@@ -151,7 +151,7 @@ void HeaderGenerator::generateClass(TextStream &s, const GeneratorContext &class
         int maxOverrides = 0;
         for (const auto &func : funcs) {
             if (!func->attributes().testFlag(AbstractMetaFunction::FinalCppMethod)) {
-                writeFunction(s, func);
+                writeFunction(s, func, &inheritedOverloads);
                 // PYSIDE-803: Build a boolean cache for unused overrides.
                 if (shouldWriteVirtualMethodNative(func))
                     maxOverrides++;
@@ -183,19 +183,20 @@ void *qt_metacast(const char *_clname) override;
 )";
         }
 
-        if (!m_inheritedOverloads.isEmpty()) {
+        if (!inheritedOverloads.isEmpty()) {
             s << "// Inherited overloads, because the using keyword sux\n";
-            for (const auto &func : qAsConst(m_inheritedOverloads))
+            for (const auto &func : qAsConst(inheritedOverloads))
                 writeMemberFunctionWrapper(s, func);
-            m_inheritedOverloads.clear();
         }
 
         if (usePySideExtensions())
             s << "static void pysideInitQtMetaTypes();\n";
 
         s << "void resetPyMethodCache();\n"
+            << "void setPyTypeMethodCache(PyTypeObject *type);\n"
             << outdent << "private:\n" << indent
             << "mutable bool m_PyMethodCache[" << maxOverrides << "];\n"
+            << "bool *m_PyTypeMethodCache = nullptr;\n"
             << outdent << "};\n\n";
         if (!innerHeaderGuard.isEmpty())
             s << "#  endif // SBK_" << innerHeaderGuard << "_H\n\n";
@@ -261,7 +262,8 @@ void HeaderGenerator::writeMemberFunctionWrapper(TextStream &s,
     s << "); }\n";
 }
 
-void HeaderGenerator::writeFunction(TextStream &s, const AbstractMetaFunctionCPtr &func)
+void HeaderGenerator::writeFunction(TextStream &s, const AbstractMetaFunctionCPtr &func,
+                                    InheritedOverloads *inheritedOverloads)
 {
 
     // do not write copy ctors here.
@@ -308,7 +310,7 @@ void HeaderGenerator::writeFunction(TextStream &s, const AbstractMetaFunctionCPt
                 && !f->isAbstract()
                 && !f->isStatic()
                 && f->name() == func->name()) {
-                m_inheritedOverloads << f;
+                inheritedOverloads->insert(f);
             }
         }
 
@@ -589,6 +591,8 @@ bool HeaderGenerator::finishGeneration()
 
     s << "#include <sbkpython.h>\n";
     s << "#include <sbkconverter.h>\n";
+    if (useLazyInit())
+        s << "#include <sbkmodule.h>\n";
 
     QStringList requiredTargetImports = TypeDatabase::instance()->requiredTargetImports();
     if (!requiredTargetImports.isEmpty()) {
@@ -53,7 +53,10 @@ protected:
 
 private:
     void writeCopyCtor(TextStream &s, const AbstractMetaClass *metaClass) const;
-    void writeFunction(TextStream &s, const AbstractMetaFunctionCPtr &func);
+    using InheritedOverloads = QSet<AbstractMetaFunctionCPtr>;
+
+    void writeFunction(TextStream &s, const AbstractMetaFunctionCPtr &func,
+                       InheritedOverloads *inheritedOverloads);
     void writeSbkTypeFunction(TextStream &s, const AbstractMetaEnum &cppEnum) const;
     static void writeSbkTypeFunction(TextStream &s, const AbstractMetaClass *cppClass) ;
     static void writeSbkTypeFunction(TextStream &s, const AbstractMetaType &metaType) ;
@@ -70,7 +73,6 @@ private:
                             const QSet<Include> &privateIncludes,
                             const QString &privateTypeFunctions);
 
-    QSet<AbstractMetaFunctionCPtr> m_inheritedOverloads;
     AbstractMetaClassCList m_alternateTemplateIndexes;
 };
 
@@ -35,6 +35,7 @@
 #include <abstractmetafunction.h>
 #include <abstractmetalang.h>
 #include <abstractmetalang_helpers.h>
+#include <cachelocker.h>
 #include <usingmember.h>
 #include <exception.h>
 #include <messages.h>
@@ -53,6 +54,7 @@
 #include <QtCore/QRegularExpression>
 #include <limits>
 #include <memory>
+#include <unordered_map>
 
 static const char AVOID_PROTECTED_HACK[] = "avoid-protected-hack";
 static const char PARENT_CTOR_HEURISTIC[] = "enable-parent-ctor-heuristic";
@@ -62,6 +64,8 @@ static const char USE_ISNULL_AS_NB_NONZERO[] = "use-isnull-as-nb_nonzero";
 static const char USE_OPERATOR_BOOL_AS_NB_NONZERO[] = "use-operator-bool-as-nb_nonzero";
 static const char WRAPPER_DIAGNOSTICS[] = "wrapper-diagnostics";
 static const char NO_IMPLICIT_CONVERSIONS[] = "no-implicit-conversions";
+static const char USE_FASTCALL[] = "use-fastcall";
+static const char LAZY_INIT[] = "lazy-init";
 
 const char *CPP_ARG = "cppArg";
 const char *CPP_ARG_REMOVED = "removed_cppArg";
@@ -86,7 +90,8 @@ struct GeneratorClassInfoCacheEntry
     bool needsGetattroFunction = false;
 };
 
-using GeneratorClassInfoCache = QHash<const AbstractMetaClass *, GeneratorClassInfoCacheEntry>;
+// std::unordered_map keeps references to its entries valid on insertion.
+using GeneratorClassInfoCache = std::unordered_map<const AbstractMetaClass *, GeneratorClassInfoCacheEntry>;
 
 Q_GLOBAL_STATIC(GeneratorClassInfoCache, generatorClassInfoCache)
 
@@ -572,6 +577,15 @@ QString ShibokenGenerator::cpythonTypeName(const TypeEntry *type)
 }
 
 QString ShibokenGenerator::cpythonTypeNameExt(const TypeEntry *type)
+{
+    if (m_useLazyInit) {
+        return u"Shiboken::Module::get("_qs + cppApiVariableName(type->targetLangPackage())
+            + u", "_qs + getTypeIndexVariableName(type) + u')';
+    }
+    return cpythonTypeArrayEntry(type);
+}
+
+QString ShibokenGenerator::cpythonTypeArrayEntry(const TypeEntry *type)
 {
     return cppApiVariableName(type->targetLangPackage()) + QLatin1Char('[')
             + getTypeIndexVariableName(type) + QLatin1Char(']');
@@ -636,6 +650,16 @@ QString ShibokenGenerator::converterObject(const TypeEntry *type)
 }
 
 QString ShibokenGenerator::cpythonTypeNameExt(const AbstractMetaType &type)
+{
+    if (m_useLazyInit) {
+        return u"Shiboken::Module::get("_qs
+            + cppApiVariableName(type.typeEntry()->targetLangPackage())
+            + u", "_qs + getTypeIndexVariableName(type) + u')';
+    }
+    return cpythonTypeArrayEntry(type);
+}
+
+QString ShibokenGenerator::cpythonTypeArrayEntry(const AbstractMetaType &type)
 {
     return cppApiVariableName(type.typeEntry()->targetLangPackage()) + QLatin1Char('[')
            + getTypeIndexVariableName(type) + QLatin1Char(']');
@@ -1939,14 +1963,15 @@ ShibokenGenerator::FunctionGroups ShibokenGenerator::getGlobalFunctionGroups() c
 
 const GeneratorClassInfoCacheEntry &ShibokenGenerator::getGeneratorClassInfo(const AbstractMetaClass *scope)
 {
+    CacheLocker locker;
     auto cache = generatorClassInfoCache();
     auto it = cache->find(scope);
     if (it == cache->end()) {
-        it = cache->insert(scope, {});
-        it.value().functionGroups = getFunctionGroupsImpl(scope);
-        it.value().needsGetattroFunction = classNeedsGetattroFunctionImpl(scope);
+        it = cache->insert({scope, {}}).first;
+        it->second.functionGroups = getFunctionGroupsImpl(scope);
+        it->second.needsGetattroFunction = classNeedsGetattroFunctionImpl(scope);
     }
-    return it.value();
+    return it->second;
 }
 
 ShibokenGenerator::FunctionGroups ShibokenGenerator::getFunctionGroups(const AbstractMetaClass *scope)
@@ -2100,6 +2125,13 @@ Generator::OptionDescriptions ShibokenGenerator::options() const
                        "the value of boolean casts")},
         {QLatin1String(NO_IMPLICIT_CONVERSIONS),
          u"Do not generate implicit_conversions for function arguments."_qs},
+        {QLatin1String(USE_FASTCALL),
+         u"Use the METH_FASTCALL calling convention for method wrappers\n"
+          "(the generated module requires Python 3.7, which is checked on import\n"
+          "when building for the limited API)."_qs},
+        {QLatin1String(LAZY_INIT),
+         u"Create the wrapper types of the module on first use instead of at import\n"
+          "(all modules depending on the module need to use it as well)."_qs},
         {QLatin1String(WRAPPER_DIAGNOSTICS),
          QLatin1String("Generate diagnostic code around wrappers")}
     });
@@ -2128,6 +2160,10 @@ bool ShibokenGenerator::handleOption(const QString &key, const QString &value)
     }
     if (key == QLatin1String(WRAPPER_DIAGNOSTICS))
         return (m_wrapperDiagnostics = true);
+    if (key == QLatin1String(USE_FASTCALL))
+        return (m_useFastcall = true);
+    if (key == QLatin1String(LAZY_INIT))
+        return (m_useLazyInit = true);
     return false;
 }
 
@@ -2241,6 +2277,18 @@ bool ShibokenGenerator::generateImplicitConversions() const
     return m_generateImplicitConversions;
 }
 
+bool ShibokenGenerator::useFastcall() const
+{
+    return m_useFastcall;
+}
+
+bool ShibokenGenerator::m_useLazyInit = false;
+
+bool ShibokenGenerator::useLazyInit()
+{
+    return m_useLazyInit;
+}
+
 QString ShibokenGenerator::moduleCppPrefix(const QString &moduleName)
  {
     QString result = moduleName.isEmpty() ? packageName() : moduleName;
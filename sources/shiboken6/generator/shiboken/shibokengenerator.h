@@ -97,6 +97,7 @@ public:
 
 protected:
     bool doSetup() override;
+    bool supportsConcurrentGeneration() const override { return true; }
 
     GeneratorContext contextForClass(const AbstractMetaClass *c) const override;
 
@@ -233,6 +234,10 @@ protected:
     static QString cpythonTypeName(const TypeEntry *type);
     static QString cpythonTypeNameExt(const TypeEntry *type);
     static QString cpythonTypeNameExt(const AbstractMetaType &type) ;
+    /// Returns the entry of the type array, which is used to store the type
+    /// when creating it, bypassing lazy creation.
+    static QString cpythonTypeArrayEntry(const TypeEntry *type);
+    static QString cpythonTypeArrayEntry(const AbstractMetaType &type);
     QString cpythonCheckFunction(const TypeEntry *type) const;
     QString cpythonCheckFunction(AbstractMetaType metaType) const;
     static QString cpythonIsConvertibleFunction(const TypeEntry *type);
@@ -293,6 +298,10 @@ protected:
     bool avoidProtectedHack() const;
     /// Generate implicit conversions of function arguments
     bool generateImplicitConversions() const;
+    /// Returns true if method wrappers should use the METH_FASTCALL calling convention.
+    bool useFastcall() const;
+    /// Returns true if the wrapper types should be created on first use.
+    static bool useLazyInit();
     static QString cppApiVariableName(const QString &moduleName = QString());
     static QString pythonModuleObjectName(const QString &moduleName = QString());
     static QString convertersVariableName(const QString &moduleName = QString());
@@ -457,6 +466,8 @@ private:
     // FIXME PYSIDE 7 Flip generateImplicitConversions default or remove?
     bool m_generateImplicitConversions = true;
     bool m_wrapperDiagnostics = false;
+    bool m_useFastcall = false;
+    static bool m_useLazyInit;
 
     /// Type system converter variable replacement names and regular expressions.
     static const QHash<int, QString> &typeSystemConvName();
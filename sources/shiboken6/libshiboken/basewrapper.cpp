@@ -55,6 +55,9 @@
 #include <set>
 #include <sstream>
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include "threadstatesaver.h"
 #include "signature.h"
 #include "voidptr.h"
@@ -71,11 +74,10 @@ namespace {
 
 static void callDestructor(const Shiboken::DtorAccumulatorVisitor::DestructorEntries &dts)
 {
-    for (const auto &e : dts) {
-        Shiboken::ThreadStateSaver threadSaver;
-        threadSaver.save();
+    Shiboken::ThreadStateSaver threadSaver;
+    threadSaver.save();
+    for (const auto &e : dts)
         e.destructor(e.cppInstance);
-    }
 }
 
 extern "C"
@@ -103,6 +105,14 @@ void setDestroyQApplication(DestroyQAppHook func)
     DestroyQApplication = func;
 }
 
+static TypeSetAttrHook TypeSetAttrNotify = nullptr;
+
+// PYSIDE-803: Provide a hook to invalidate data derived from the type dicts.
+void setTypeSetAttrHook(TypeSetAttrHook func)
+{
+    TypeSetAttrNotify = func;
+}
+
 // PYSIDE-535: Use the C API in PyPy instead of `op->ob_dict`, directly
 LIBSHIBOKEN_API PyObject *SbkObject_GetDict(PyObject *op)
 {
@@ -157,9 +167,22 @@ static PyGetSetDef SbkObjectType_Type_getsetlist[] = {
     {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
 };
 
+// PYSIDE-803: Setting an attribute of a type may override virtual methods.
+static int SbkObjectType_setattro(PyObject *type, PyObject *name, PyObject *value)
+{
+    static setattrofunc type_setattro = PyType_Type.tp_setattro;
+    auto *pyType = reinterpret_cast<PyTypeObject *>(type);
+    Shiboken::ObjectType::clearOverrideCaches(pyType);
+    const int result = type_setattro(type, name, value);
+    if (result == 0 && TypeSetAttrNotify != nullptr)
+        TypeSetAttrNotify(pyType);
+    return result;
+}
+
 static PyType_Slot SbkObjectType_Type_slots[] = {
     {Py_tp_dealloc, reinterpret_cast<void *>(SbkObjectTypeDealloc)},
     {Py_tp_getattro, reinterpret_cast<void *>(mangled_type_getattro)},
+    {Py_tp_setattro, reinterpret_cast<void *>(SbkObjectType_setattro)},
     {Py_tp_base, static_cast<void *>(&PyType_Type)},
     {Py_tp_alloc, reinterpret_cast<void *>(PyType_GenericAlloc)},
     {Py_tp_new, reinterpret_cast<void *>(SbkObjectTypeTpNew)},
@@ -279,13 +302,6 @@ PyTypeObject *SbkObject_TypeF(void)
     return type;
 }
 
-static int mainThreadDeletionHandler(void *)
-{
-    if (Py_IsInitialized())
-        Shiboken::BindingManager::instance().runDeletionInMainThread();
-    return 0;
-}
-
 static void SbkDeallocWrapperCommon(PyObject *pyObj, bool canDelete)
 {
     auto *sbkObj = reinterpret_cast<SbkObject *>(pyObj);
@@ -349,7 +365,6 @@ static void SbkDeallocWrapperCommon(PyObject *pyObj, bool canDelete)
                 Shiboken::DestructorEntry e{sotp->cpp_dtor, sbkObj->d->cptr[0]};
                 bindingManager.addToDeletionInMainThread(e);
             }
-            Py_AddPendingCall(mainThreadDeletionHandler, nullptr);
             canDelete = false;
         }
     }
@@ -360,19 +375,38 @@ static void SbkDeallocWrapperCommon(PyObject *pyObj, bool canDelete)
     PyErr_Fetch(&error_type, &error_value, &error_traceback);
 
     if (canDelete) {
+        auto &bindingManager = Shiboken::BindingManager::instance();
+        // Objects with Python overrides are destroyed immediately to keep
+        // the timing of their destructors.
+        const bool defer = !sbkObj->d->containsCppWrapper && !sbkObj->d->isQAppSingleton
+            && bindingManager.isDestructionDeferred();
         if (sotp->is_multicpp) {
             Shiboken::DtorAccumulatorVisitor visitor(sbkObj);
             Shiboken::walkThroughClassHierarchy(Py_TYPE(pyObj), &visitor);
             Shiboken::Object::deallocData(sbkObj, true);
-            callDestructor(visitor.entries());
+            if (defer) {
+                for (const auto &e : visitor.entries())
+                    bindingManager.deferDestruction(e);
+            } else {
+                callDestructor(visitor.entries());
+            }
         } else {
             void *cptr = sbkObj->d->cptr[0];
+            const bool recycle = sbkObj->d->isRecyclable
+                && !sbkObj->d->containsCppWrapper
+                && sotp->instance_pool_count < sotp->instance_pool_capacity;
             Shiboken::Object::deallocData(sbkObj, true);
 
-            Shiboken::ThreadStateSaver threadSaver;
-            if (Py_IsInitialized())
-                threadSaver.save();
-            sotp->cpp_dtor(cptr);
+            if (recycle) {
+                sotp->instance_pool[sotp->instance_pool_count++] = cptr;
+            } else if (defer) {
+                bindingManager.deferDestruction(Shiboken::DestructorEntry{sotp->cpp_dtor, cptr});
+            } else {
+                Shiboken::ThreadStateSaver threadSaver;
+                if (Py_IsInitialized())
+                    threadSaver.save();
+                sotp->cpp_dtor(cptr);
+            }
         }
     } else {
         Shiboken::Object::deallocData(sbkObj, true);
@@ -423,8 +457,14 @@ void SbkObjectTypeDealloc(PyTypeObject *sbkType)
         }
         free(sotp->original_name);
         sotp->original_name = nullptr;
+        for (int i = 0; i < sotp->instance_pool_count; ++i)
+            sotp->cpp_dtor(sotp->instance_pool[i]);
+        delete [] sotp->instance_pool;
+        sotp->instance_pool = nullptr;
+        sotp->instance_pool_count = sotp->instance_pool_capacity = 0;
         if (!Shiboken::ObjectType::isUserType(sbkType))
             Shiboken::Conversions::deleteConverter(sotp->converter);
+        Shiboken::ObjectType::releaseOverrideCaches(sbkType);
         PepType_SOTP_delete(sbkType);
     }
 #ifndef Py_LIMITED_API
@@ -567,6 +607,76 @@ static PyTypeObject *SbkObjectTypeTpNew(PyTypeObject *metatype, PyObject *args,
     return newType;
 }
 
+// Pool of SbkObjectPrivate blocks. Wrappers are created and destroyed in large
+// numbers for value types, the blocks of destroyed wrappers are kept in a
+// free list instead of being returned to the heap.
+class ObjectPrivatePool
+{
+public:
+    void *allocate()
+    {
+        if (m_free == nullptr)
+            grow();
+        Block *block = m_free;
+        m_free = block->next;
+        ++m_used;
+        return block;
+    }
+
+    void deallocate(void *p)
+    {
+        auto *block = reinterpret_cast<Block *>(p);
+        block->next = m_free;
+        m_free = block;
+        --m_used;
+    }
+
+    std::size_t capacity() const { return m_capacity; }
+    std::size_t used() const { return m_used; }
+
+private:
+    union Block
+    {
+        Block *next;
+        alignas(SbkObjectPrivate) unsigned char storage[sizeof(SbkObjectPrivate)];
+    };
+
+    static constexpr std::size_t chunkSize = 256;
+
+    void grow()
+    {
+        // Chunks are never released, wrappers may be destroyed late at exit.
+        auto *chunk = new Block[chunkSize];
+        for (std::size_t i = 0; i < chunkSize; ++i) {
+            chunk[i].next = m_free;
+            m_free = chunk + i;
+        }
+        m_capacity += chunkSize;
+    }
+
+    Block *m_free = nullptr;
+    std::size_t m_capacity = 0;
+    std::size_t m_used = 0;
+};
+
+static ObjectPrivatePool &objectPrivatePool()
+{
+    static auto *pool = new ObjectPrivatePool;
+    return *pool;
+}
+
+void *SbkObjectPrivate::operator new(std::size_t size)
+{
+    assert(size == sizeof(SbkObjectPrivate));
+    return objectPrivatePool().allocate();
+}
+
+void SbkObjectPrivate::operator delete(void *block)
+{
+    if (block != nullptr)
+        objectPrivatePool().deallocate(block);
+}
+
 static PyObject *_setupNew(SbkObject *self, PyTypeObject *subtype)
 {
     auto *obSubtype = reinterpret_cast<PyObject *>(subtype);
@@ -579,7 +689,7 @@ static PyObject *_setupNew(SbkObject *self, PyTypeObject *subtype)
     auto *sotp = PepType_SOTP(sbkSubtype);
     int numBases = ((sotp && sotp->is_multicpp) ?
         Shiboken::getNumberOfCppBaseClasses(subtype) : 1);
-    d->cptr = new void *[numBases];
+    d->cptr = numBases == 1 ? &d->singleCptr : new void *[numBases];
     std::memset(d->cptr, 0, sizeof(void *) *size_t(numBases));
     d->hasOwnership = 1;
     d->containsCppWrapper = 0;
@@ -587,6 +697,8 @@ static PyObject *_setupNew(SbkObject *self, PyTypeObject *subtype)
     d->parentInfo = nullptr;
     d->referredObjects = nullptr;
     d->cppObjectCreated = 0;
+    d->isQAppSingleton = 0;
+    d->isRecyclable = 0;
     self->ob_dict = nullptr;
     self->weakreflist = nullptr;
     self->d = d;
@@ -658,7 +770,7 @@ void _destroyParentInfo(SbkObject *obj, bool keepReference)
     Shiboken::ParentInfo *pInfo = obj->d->parentInfo;
     if (pInfo) {
         while(!pInfo->children.empty()) {
-            SbkObject *first = *pInfo->children.begin();
+            SbkObject *first = pInfo->children.front();
             // Mark child as invalid
             Shiboken::Object::invalidate(first);
             Shiboken::Object::removeParent(first, false, keepReference);
@@ -887,6 +999,24 @@ void setDestructorFunction(PyTypeObject *type, ObjectDestructor func)
     PepType_SOTP(type)->cpp_dtor = func;
 }
 
+void setInstancePoolSize(PyTypeObject *type, int size)
+{
+    auto *sotp = PepType_SOTP(type);
+    assert(sotp->instance_pool == nullptr);
+    if (size <= 0 || sotp->instance_pool != nullptr)
+        return;
+    sotp->instance_pool = new void *[size];
+    sotp->instance_pool_capacity = size;
+    sotp->instance_pool_count = 0;
+}
+
+void *takePooledInstance(PyTypeObject *type)
+{
+    auto *sotp = PepType_SOTP(type);
+    return sotp->instance_pool_count > 0
+        ? sotp->instance_pool[--sotp->instance_pool_count] : nullptr;
+}
+
 PyTypeObject *
 introduceWrapperType(PyObject *enclosingObject,
                      const char *typeName,
@@ -964,6 +1094,131 @@ bool hasSpecialCastFunction(PyTypeObject *sbkType)
     return d != nullptr && d->mi_specialcast != nullptr;
 }
 
+// PYSIDE-803: Flags caching the virtual methods of a C++ wrapper class which are
+// not overridden by a Python type. They are cleared when an attribute of the type
+// or of one of its bases is set. This cannot be detected for bases not created by
+// Shiboken (mixins), so types having such bases do not get flags. The C++ wrappers
+// using the flags hold a reference since they may outlive their type.
+struct OverrideCache
+{
+    PyTypeObject *type; // nullptr once the type is deleted
+    const void *key;
+    int size;
+    int refCount;
+};
+
+struct OverrideCaches
+{
+    std::mutex mutex;
+    std::unordered_map<bool *, OverrideCache> caches;
+    std::unordered_map<PyTypeObject *, std::vector<bool *>> typeCaches;
+};
+
+static OverrideCaches &overrideCaches()
+{
+    static auto *result = new OverrideCaches; // Used by C++ wrapper dtors, leaked
+    return *result;
+}
+
+bool canCacheOverrides(PyTypeObject *type)
+{
+    PyObject *mro = type->tp_mro;
+    const Py_ssize_t size = PyTuple_GET_SIZE(mro);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *base = PyTuple_GET_ITEM(mro, i);
+        if (base != reinterpret_cast<PyObject *>(&PyBaseObject_Type)
+            && PyObject_TypeCheck(base, SbkObjectType_TypeF()) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool *acquireOverrideCache(PyTypeObject *type, const void *key, int size)
+{
+    if (!canCacheOverrides(type))
+        return nullptr;
+    auto &o = overrideCaches();
+    std::lock_guard<std::mutex> lock(o.mutex);
+    auto &typeCaches = o.typeCaches[type];
+    for (bool *flags : typeCaches) {
+        auto &cache = o.caches[flags];
+        if (cache.key == key) {
+            ++cache.refCount;
+            return flags;
+        }
+    }
+    bool *flags = new bool[size]();
+    o.caches.insert({flags, {type, key, size, 1}});
+    typeCaches.push_back(flags);
+    return flags;
+}
+
+void releaseOverrideCache(bool *flags)
+{
+    auto &o = overrideCaches();
+    std::lock_guard<std::mutex> lock(o.mutex);
+    auto it = o.caches.find(flags);
+    if (it != o.caches.end() && --it->second.refCount == 0 && it->second.type == nullptr) {
+        o.caches.erase(it);
+        delete [] flags;
+    }
+}
+
+// Collects a type and its subclasses, recursively.
+static void collectSubTypes(PyObject *type, std::vector<PyTypeObject *> *result)
+{
+    result->push_back(reinterpret_cast<PyTypeObject *>(type));
+    AutoDecRef subTypes(PyObject_CallMethod(type, "__subclasses__", nullptr));
+    if (subTypes.isNull()) {
+        PyErr_Clear();
+        return;
+    }
+    const Py_ssize_t size = PyList_Size(subTypes.object());
+    for (Py_ssize_t i = 0; i < size; ++i)
+        collectSubTypes(PyList_GetItem(subTypes.object(), i), result);
+}
+
+void clearOverrideCaches(PyTypeObject *type)
+{
+    auto &o = overrideCaches();
+    {
+        std::lock_guard<std::mutex> lock(o.mutex);
+        if (o.typeCaches.empty())
+            return;
+    }
+    std::vector<PyTypeObject *> types;
+    collectSubTypes(reinterpret_cast<PyObject *>(type), &types);
+    std::lock_guard<std::mutex> lock(o.mutex);
+    for (auto *t : types) {
+        auto it = o.typeCaches.find(t);
+        if (it != o.typeCaches.end()) {
+            for (bool *flags : it->second)
+                std::fill_n(flags, o.caches[flags].size, false);
+        }
+    }
+}
+
+void releaseOverrideCaches(PyTypeObject *type)
+{
+    auto &o = overrideCaches();
+    std::lock_guard<std::mutex> lock(o.mutex);
+    auto it = o.typeCaches.find(type);
+    if (it == o.typeCaches.end())
+        return;
+    for (bool *flags : it->second) {
+        auto cacheIt = o.caches.find(flags);
+        if (cacheIt->second.refCount == 0) {
+            o.caches.erase(cacheIt);
+            delete [] flags;
+        } else {
+            std::fill_n(flags, cacheIt->second.size, false);
+            cacheIt->second.type = nullptr;
+        }
+    }
+    o.typeCaches.erase(it);
+}
+
 } // namespace ObjectType
 
 
@@ -1071,8 +1326,7 @@ void callCppDestructors(SbkObject *pyObj)
        invalidate doesn't */
     invalidate(pyObj);
 
-    delete[] priv->cptr;
-    priv->cptr = nullptr;
+    priv->deleteCptr();
     priv->validCppObject = false;
 }
 
@@ -1166,7 +1420,7 @@ static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen)
     // If it is a parent invalidate all children.
     if (self->d->parentInfo) {
         // Create a copy because this list can be changed during the process
-        ChildrenList copy = self->d->parentInfo->children;
+        const std::vector<SbkObject *> copy = self->d->parentInfo->children.toVector();
 
         for (SbkObject *child : copy) {
             // invalidate the child
@@ -1321,7 +1575,7 @@ SbkObject *findColocatedChild(SbkObject *wrapper,
     if (!pInfo)
         return nullptr;
 
-    ChildrenList &children = pInfo->children;
+    const ChildrenList &children = pInfo->children;
 
     for (SbkObject *child : children) {
         if (!(child->d && child->d->cptr))
@@ -1353,9 +1607,7 @@ PyObject *newObject(PyTypeObject *instanceType,
     SbkObject *self = nullptr;
 
     // Some logic to ensure that colocated child field does not overwrite the parent
-    if (BindingManager::instance().hasWrapper(cptr)) {
-        SbkObject *existingWrapper = BindingManager::instance().retrieveWrapper(cptr);
-
+    if (SbkObject *existingWrapper = BindingManager::instance().retrieveWrapper(cptr)) {
         self = findColocatedChild(existingWrapper, instanceType);
         if (self) {
             // Wrapper already registered for cptr.
@@ -1390,6 +1642,16 @@ PyObject *newObject(PyTypeObject *instanceType,
     return reinterpret_cast<PyObject *>(self);
 }
 
+PyObject *newRecyclableObject(PyTypeObject *instanceType, void *cptr)
+{
+    PyObject *result = newObject(instanceType, cptr, true, true);
+    auto *self = reinterpret_cast<SbkObject *>(result);
+    // A pre-existing wrapper of a colocated object must not be recycled.
+    if (self->d->cptr[0] == cptr && Py_TYPE(result) == instanceType)
+        self->d->isRecyclable = 1;
+    return result;
+}
+
 void destroy(SbkObject *self, void *cppData)
 {
     // Skip if this is called with NULL pointer this can happen in derived classes
@@ -1427,8 +1689,7 @@ void destroy(SbkObject *self, void *cppData)
         self->d->hasOwnership = false;
 
         // the cpp object instance was deleted
-        delete[] self->d->cptr;
-        self->d->cptr = nullptr;
+        self->d->deleteCptr();
     }
 
     // After this point the object can be death do not use the self pointer bellow
@@ -1446,11 +1707,10 @@ void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
 
     ChildrenList &oldBrothers = pInfo->parent->d->parentInfo->children;
     // Verify if this child is part of parent list
-    auto iChild = oldBrothers.find(child);
-    if (iChild == oldBrothers.end())
+    if (!oldBrothers.contains(child))
         return;
 
-    oldBrothers.erase(iChild);
+    oldBrothers.erase(child);
 
     pInfo->parent = nullptr;
 
@@ -1485,7 +1745,7 @@ void setParent(PyObject *parent, PyObject *child)
      * so if you pass this class to someone that takes the ownership, we CAN'T enter in this if, but hey! QString
      * follows the sequence protocol.
      */
-    if (PySequence_Check(child) && !Object::checkType(child)) {
+    if (!Object::checkType(child) && PySequence_Check(child)) {
         Shiboken::AutoDecRef seq(PySequence_Fast(child, nullptr));
         for (Py_ssize_t i = 0, max = PySequence_Size(seq); i < max; ++i)
             setParent(parent, PySequence_Fast_GET_ITEM(seq.object(), i));
@@ -1522,7 +1782,7 @@ void setParent(PyObject *parent, PyObject *child)
             pInfo = child_->d->parentInfo = new ParentInfo;
 
         pInfo->parent = parent_;
-        parent_->d->parentInfo->children.insert(child_);
+        parent_->d->parentInfo->children.push_back(child_);
 
         // Add Parent ref
         Py_INCREF(child_);
@@ -1550,8 +1810,7 @@ void deallocData(SbkObject *self, bool cleanup)
     if (self->d->cptr) {
         // Remove from BindingManager
         Shiboken::BindingManager::instance().releaseWrapper(self);
-        delete[] self->d->cptr;
-        self->d->cptr = nullptr;
+        self->d->deleteCptr();
         // delete self->d; PYSIDE-205: wrong!
     }
     delete self->d; // PYSIDE-205: always delete d.
@@ -1699,6 +1958,15 @@ std::string info(SbkObject *self)
     return s.str();
 }
 
+PrivateDataPoolStatistics privateDataPoolStatistics()
+{
+    const auto &pool = objectPrivatePool();
+    PrivateDataPoolStatistics result;
+    result.capacity = pool.capacity();
+    result.used = pool.used();
+    return result;
+}
+
 } // namespace Object
 
 } // namespace Shiboken
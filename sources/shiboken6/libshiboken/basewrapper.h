@@ -112,6 +112,11 @@ LIBSHIBOKEN_API void SbkObjectType_SetPropertyStrings(PyTypeObject *type, const
 typedef void(*DestroyQAppHook)();
 LIBSHIBOKEN_API void setDestroyQApplication(DestroyQAppHook func);
 
+/// PYSIDE-803: Set the function notified after an attribute of a type was set,
+/// for example to drop data derived from the type dicts.
+typedef void(*TypeSetAttrHook)(PyTypeObject *);
+LIBSHIBOKEN_API void setTypeSetAttrHook(TypeSetAttrHook func);
+
 /// PYSIDE-535: Use the C API in PyPy instead of `op->ob_dict`, directly (borrowed ref)
 LIBSHIBOKEN_API PyObject *SbkObject_GetDict(PyObject *op);
 
@@ -214,6 +219,18 @@ LIBSHIBOKEN_API MultipleInheritanceInitFunction getMultipleInheritanceFunction(P
 
 LIBSHIBOKEN_API void setDestructorFunction(PyTypeObject *self, ObjectDestructor func);
 
+/**
+ *  Enables keeping up to \p size C++ instances of the value type \p self
+ *  for reuse when wrappers created by Object::newRecyclableObject() are
+ *  deleted. Must be called before any such wrapper exists.
+ */
+LIBSHIBOKEN_API void setInstancePoolSize(PyTypeObject *self, int size);
+/**
+ *  Takes a C++ instance from the pool of \p self for the copy conversion
+ *  to assign to, or returns nullptr if the pool is empty.
+ */
+LIBSHIBOKEN_API void *takePooledInstance(PyTypeObject *self);
+
 enum WrapperFlags
 {
     InnerClass = 0x1,
@@ -275,6 +292,22 @@ LIBSHIBOKEN_API PyTypeObject *typeForTypeName(const char *typeName);
  * \since 5.12
  */
 LIBSHIBOKEN_API bool hasSpecialCastFunction(PyTypeObject *sbkType);
+
+/**
+ *  Returns the flags caching which of the \p size virtual methods of the C++
+ *  wrapper class identified by \p key are not overridden by the Python type
+ *  \p type, adding a reference. The flags are cleared when an attribute of the
+ *  type or one of its bases is set. Returns nullptr for types having bases not
+ *  created by Shiboken, whose attributes might be set unnoticed.
+ *  \since 6.2
+ */
+LIBSHIBOKEN_API bool *acquireOverrideCache(PyTypeObject *type, const void *key, int size);
+
+/**
+ *  Releases a reference to flags returned by acquireOverrideCache().
+ *  \since 6.2
+ */
+LIBSHIBOKEN_API void releaseOverrideCache(bool *flags);
 }
 
 namespace Object {
@@ -321,6 +354,13 @@ LIBSHIBOKEN_API PyObject *newObject(PyTypeObject *instanceType,
                                     bool isExactType = false,
                                     const char *typeName = nullptr);
 
+/**
+ *  Bind a C++ object of exactly \p instanceType owned by Python whose memory
+ *  is returned to the instance pool of the type on deletion instead of being
+ *  destroyed (see ObjectType::setInstancePoolSize()).
+ */
+LIBSHIBOKEN_API PyObject *newRecyclableObject(PyTypeObject *instanceType, void *cptr);
+
 /**
  *  Changes the valid flag of a PyObject, invalid objects will raise an exception when someone tries to access it.
  */
@@ -479,6 +519,21 @@ LIBSHIBOKEN_API void keepReference(SbkObject *self, const char *key, PyObject *r
  */
 LIBSHIBOKEN_API void removeReference(SbkObject *self, const char *key, PyObject *referredObject);
 
+struct PrivateDataPoolStatistics
+{
+    /// Number of private data blocks allocated by the pool and number in use.
+    unsigned long long capacity = 0;
+    unsigned long long used = 0;
+};
+
+/**
+ *   Return statistics of the pool from which the private data of wrappers
+ *   are taken.
+ *   \note This function was added to libshiboken only to be used by
+ *   shiboken.privateDataPoolStatistics()
+ */
+LIBSHIBOKEN_API PrivateDataPoolStatistics privateDataPoolStatistics();
+
 } // namespace Object
 
 } // namespace Shiboken
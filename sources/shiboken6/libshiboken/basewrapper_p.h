@@ -43,8 +43,9 @@
 #include "sbkpython.h"
 #include "basewrapper.h"
 
+#include <cstddef>
+#include <iterator>
 #include <unordered_map>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -59,8 +60,60 @@ namespace Shiboken
     */
 using RefCountMap = std::unordered_multimap<std::string, PyObject *> ;
 
-/// Linked list of SbkBaseWrapper pointers
-using ChildrenList = std::set<SbkObject *>;
+/// Intrusive doubly linked list of the children of an object. The links are
+/// stored in the ParentInfo of the children, so that adding and removing a
+/// child is O(1) and does not allocate. Children must have a ParentInfo.
+class ChildrenList
+{
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SbkObject *;
+        using difference_type = std::ptrdiff_t;
+        using pointer = SbkObject *const *;
+        using reference = SbkObject *const &;
+
+        explicit const_iterator(SbkObject *child = nullptr) : m_child(child) {}
+
+        reference operator*() const { return m_child; }
+        inline const_iterator &operator++();
+        const_iterator operator++(int)
+        {
+            const_iterator result = *this;
+            ++(*this);
+            return result;
+        }
+        bool operator==(const const_iterator &rhs) const { return m_child == rhs.m_child; }
+        bool operator!=(const const_iterator &rhs) const { return m_child != rhs.m_child; }
+
+    private:
+        SbkObject *m_child;
+    };
+
+    ChildrenList() = default;
+    ChildrenList(const ChildrenList &) = delete;
+    ChildrenList &operator=(const ChildrenList &) = delete;
+
+    bool empty() const { return m_first == nullptr; }
+    std::size_t size() const { return m_size; }
+    SbkObject *front() const { return m_first; }
+    const_iterator begin() const { return const_iterator(m_first); }
+    const_iterator end() const { return const_iterator(); }
+
+    inline bool contains(const SbkObject *child) const;
+    inline void push_back(SbkObject *child);
+    inline void erase(SbkObject *child);
+
+    /// Returns a copy for iterations during which the list may change.
+    std::vector<SbkObject *> toVector() const { return {begin(), end()}; }
+
+private:
+    SbkObject *m_first = nullptr;
+    SbkObject *m_last = nullptr;
+    std::size_t m_size = 0;
+};
 
 /// Structure used to store information about object parent and children.
 struct ParentInfo
@@ -69,6 +122,9 @@ struct ParentInfo
     ParentInfo() : parent(nullptr), hasWrapperRef(false) {}
     /// Pointer to parent object.
     SbkObject *parent;
+    /// Links of the object within the children list of its parent.
+    SbkObject *previousSibling = nullptr;
+    SbkObject *nextSibling = nullptr;
     /// List of object children.
     ChildrenList children;
     /// has internal ref
@@ -99,10 +155,15 @@ struct SbkObjectPrivate
     /// PYSIDE-1470: Marked as true if this is the Q*Application singleton.
     /// This bit allows app deletion from shiboken?.delete() .
     unsigned int isQAppSingleton : 1;
+    /// Marked as true when the C++ object may be returned to the instance
+    /// pool of the type on deletion (see ObjectType::setInstancePoolSize()).
+    unsigned int isRecyclable : 1;
     /// Information about the object parents and children, may be null.
     Shiboken::ParentInfo *parentInfo;
     /// Manage reference count of objects that are referred to but not owned from.
     Shiboken::RefCountMap *referredObjects;
+    /// Storage used as cptr array by types with a single C++ base.
+    void *singleCptr;
 
     ~SbkObjectPrivate()
     {
@@ -111,6 +172,19 @@ struct SbkObjectPrivate
         delete referredObjects;
         referredObjects = nullptr;
     }
+
+    /// Free the cptr array unless it is the inline storage.
+    void deleteCptr()
+    {
+        if (cptr != &singleCptr)
+            delete[] cptr;
+        cptr = nullptr;
+    }
+
+    /// Instances are taken from a pool of blocks (see basewrapper.cpp), the
+    /// GIL must be held.
+    static void *operator new(std::size_t size);
+    static void operator delete(void *block);
 };
 
 // TODO-CONVERTERS: to be deprecated/removed
@@ -148,6 +222,10 @@ struct SbkObjectTypePrivate
     DeleteUserDataFunc d_func;
     void (*subtype_init)(PyTypeObject *, PyObject *, PyObject *);
     const char **propertyStrings;
+    /// C++ instances kept for reuse by the copy conversion, see ObjectType::setInstancePoolSize().
+    void **instance_pool;
+    int instance_pool_capacity;
+    int instance_pool_count;
 };
 
 
@@ -156,6 +234,46 @@ struct SbkObjectTypePrivate
 namespace Shiboken
 {
 
+inline ChildrenList::const_iterator &ChildrenList::const_iterator::operator++()
+{
+    m_child = m_child->d->parentInfo->nextSibling;
+    return *this;
+}
+
+inline bool ChildrenList::contains(const SbkObject *child) const
+{
+    const ParentInfo *info = child->d->parentInfo;
+    return info != nullptr && (info->previousSibling != nullptr || m_first == child);
+}
+
+inline void ChildrenList::push_back(SbkObject *child)
+{
+    ParentInfo *info = child->d->parentInfo;
+    info->previousSibling = m_last;
+    info->nextSibling = nullptr;
+    if (m_last != nullptr)
+        m_last->d->parentInfo->nextSibling = child;
+    else
+        m_first = child;
+    m_last = child;
+    ++m_size;
+}
+
+inline void ChildrenList::erase(SbkObject *child)
+{
+    ParentInfo *info = child->d->parentInfo;
+    if (info->previousSibling != nullptr)
+        info->previousSibling->d->parentInfo->nextSibling = info->nextSibling;
+    else
+        m_first = info->nextSibling;
+    if (info->nextSibling != nullptr)
+        info->nextSibling->d->parentInfo->previousSibling = info->previousSibling;
+    else
+        m_last = info->previousSibling;
+    info->previousSibling = info->nextSibling = nullptr;
+    --m_size;
+}
+
 /**
  * \internal
  * Data required to invoke a C++ destructor
@@ -166,6 +284,19 @@ struct DestructorEntry
     void *cppInstance;
 };
 
+namespace ObjectType
+{
+
+/// Returns whether setting attributes of all bases of a type can be detected,
+/// so that acquireOverrideCache() can be used.
+bool canCacheOverrides(PyTypeObject *type);
+/// Clears the flags returned by acquireOverrideCache() for a type and its subtypes.
+void clearOverrideCaches(PyTypeObject *type);
+/// Detaches the flags returned by acquireOverrideCache() from a type being deleted.
+void releaseOverrideCaches(PyTypeObject *type);
+
+} // namespace ObjectType
+
 /**
  * Utility function used to transform a PyObject that implements sequence protocol into a std::list.
  **/
@@ -42,19 +42,135 @@
 #include "basewrapper_p.h"
 #include "bindingmanager.h"
 #include "gilstate.h"
+#include "helper.h"
+#include "threadstatesaver.h"
 #include "sbkstring.h"
 #include "sbkstaticstrings.h"
 #include "sbkfeature_base.h"
 #include "debugfreehook.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <unordered_map>
+#include <vector>
 
 namespace Shiboken
 {
 
-using WrapperMap = std::unordered_map<const void *, SbkObject *>;
+/// Maps C++ pointers to their wrappers using open addressing with linear
+/// probing in a flat array. Erasing an entry shifts the following entries
+/// of its probe sequence back, so that no tombstones are needed.
+class WrapperMap
+{
+public:
+    struct Entry
+    {
+        const void *key;
+        SbkObject *value;
+    };
+    using Entries = std::vector<Entry>;
+
+    WrapperMap() { rehash(minCapacityBits); }
+
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    SbkObject *find(const void *key) const
+    {
+        for (std::size_t i = indexOf(key); ; i = next(i)) {
+            const Entry &entry = m_entries[i];
+            if (entry.key == key || entry.key == nullptr)
+                return entry.value;
+        }
+    }
+
+    /// Returns the value of \p key or inserts \p value for it and returns nullptr.
+    SbkObject *findOrInsert(const void *key, SbkObject *value)
+    {
+        if (4 * (m_size + 1) > 3 * m_entries.size())
+            rehash(m_bits + 1);
+        std::size_t i = indexOf(key);
+        for ( ; m_entries[i].key != nullptr; i = next(i)) {
+            if (m_entries[i].key == key)
+                return m_entries[i].value;
+        }
+        m_entries[i] = {key, value};
+        ++m_size;
+        return nullptr;
+    }
+
+    /// Erases \p key if its value is \p value or \p value is nullptr.
+    bool erase(const void *key, const SbkObject *value = nullptr)
+    {
+        std::size_t hole = indexOf(key);
+        for ( ; m_entries[hole].key != key; hole = next(hole)) {
+            if (m_entries[hole].key == nullptr)
+                return false;
+        }
+        if (value != nullptr && m_entries[hole].value != value)
+            return false;
+        // Move entries following in the probe sequence into the hole
+        // unless it precedes their home position.
+        for (std::size_t i = next(hole); m_entries[i].key != nullptr; i = next(i)) {
+            const std::size_t home = indexOf(m_entries[i].key);
+            if (((i - home) & m_mask) >= ((i - hole) & m_mask)) {
+                m_entries[hole] = m_entries[i];
+                hole = i;
+            }
+        }
+        m_entries[hole] = {nullptr, nullptr};
+        --m_size;
+        return true;
+    }
+
+    /// Returns a copy of the entries for iterating while modifying the map.
+    Entries entries() const
+    {
+        Entries result;
+        result.reserve(m_size);
+        for (const Entry &entry : m_entries) {
+            if (entry.key != nullptr)
+                result.push_back(entry);
+        }
+        return result;
+    }
+
+private:
+    static constexpr unsigned minCapacityBits = 10;
+
+    std::size_t indexOf(const void *key) const
+    {
+        // Fibonacci hashing spreads the aligned pointer values.
+        const auto hash = std::uint64_t(reinterpret_cast<std::uintptr_t>(key))
+                          * 11400714819323198485ull;
+        return std::size_t(hash >> (64 - m_bits));
+    }
+
+    std::size_t next(std::size_t i) const { return (i + 1) & m_mask; }
+
+    void rehash(unsigned bits)
+    {
+        Entries old(std::size_t(1) << bits, Entry{nullptr, nullptr});
+        old.swap(m_entries);
+        m_bits = bits;
+        m_mask = m_entries.size() - 1;
+        for (const Entry &entry : old) {
+            if (entry.key != nullptr) {
+                std::size_t i = indexOf(entry.key);
+                while (m_entries[i].key != nullptr)
+                    i = next(i);
+                m_entries[i] = entry;
+            }
+        }
+    }
+
+    Entries m_entries;
+    std::size_t m_size = 0;
+    std::size_t m_mask = 0;
+    unsigned m_bits = 0;
+};
 
 class Graph
 {
@@ -125,9 +241,9 @@ static void showWrapperMap(const WrapperMap &wrapperMap)
     if (Py_VerboseFlag > 0) {
         fprintf(stderr, "-------------------------------\n");
         fprintf(stderr, "WrapperMap: %p (size: %d)\n", &wrapperMap, (int) wrapperMap.size());
-        for (auto it = wrapperMap.begin(), end = wrapperMap.end(); it != end; ++it) {
-            const SbkObject *sbkObj = it->second;
-            fprintf(stderr, "key: %p, value: %p (%s, refcnt: %d)\n", it->first,
+        for (const auto &entry : wrapperMap.entries()) {
+            const SbkObject *sbkObj = entry.value;
+            fprintf(stderr, "key: %p, value: %p (%s, refcnt: %d)\n", entry.key,
                     static_cast<const void *>(sbkObj),
                     (Py_TYPE(sbkObj))->tp_name,
                     int(reinterpret_cast<const PyObject *>(sbkObj)->ob_refcnt));
@@ -143,11 +259,17 @@ struct BindingManager::BindingManagerPrivate {
     WrapperMap wrapperMapper;
     Graph classHierarchy;
     DestructorEntries deleteInMainThread;
+    DestructorEntries deferredDestruction;
+    DestructionStatistics destructionStatistics;
+    int destructionBatchThreshold = 0;
+    bool deletionInMainThreadScheduled = false;
+    bool deferredDestructionScheduled = false;
     bool destroying;
 
     BindingManagerPrivate() : destroying(false) {}
     bool releaseWrapper(void *cptr, SbkObject *wrapper);
     void assignWrapper(SbkObject *wrapper, const void *cptr);
+    void assignOffsetWrappers(SbkObjectTypePrivate *d, SbkObject *wrapper, void *cptr);
 
 };
 
@@ -156,20 +278,29 @@ bool BindingManager::BindingManagerPrivate::releaseWrapper(void *cptr, SbkObject
     // The wrapper argument is checked to ensure that the correct wrapper is released.
     // Returns true if the correct wrapper is found and released.
     // If wrapper argument is NULL, no such check is performed.
-    auto iter = wrapperMapper.find(cptr);
-    if (iter != wrapperMapper.end() && (wrapper == nullptr || iter->second == wrapper)) {
-        wrapperMapper.erase(iter);
-        return true;
-    }
-    return false;
+    return wrapperMapper.erase(cptr, wrapper);
 }
 
 void BindingManager::BindingManagerPrivate::assignWrapper(SbkObject *wrapper, const void *cptr)
 {
     assert(cptr);
-    auto iter = wrapperMapper.find(cptr);
-    if (iter == wrapperMapper.end())
-        wrapperMapper.insert(std::make_pair(cptr, wrapper));
+    wrapperMapper.findOrInsert(cptr, wrapper);
+}
+
+// Register the pointers to the further C++ base classes in case of multiple inheritance.
+void BindingManager::BindingManagerPrivate::assignOffsetWrappers(SbkObjectTypePrivate *d,
+                                                                 SbkObject *wrapper, void *cptr)
+{
+    if (d->mi_init && !d->mi_offsets)
+        d->mi_offsets = d->mi_init(cptr);
+    if (d->mi_offsets) {
+        int *offset = d->mi_offsets;
+        while (*offset != -1) {
+            if (*offset > 0)
+                assignWrapper(wrapper, reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(cptr) + *offset));
+            offset++;
+        }
+    }
 }
 
 BindingManager::BindingManager()
@@ -194,7 +325,11 @@ BindingManager::~BindingManager()
      * shutting down. */
     if (Py_IsInitialized()) {  // ensure the interpreter is still valid
         while (!m_d->wrapperMapper.empty()) {
-            Object::destroy(m_d->wrapperMapper.begin()->second, const_cast<void *>(m_d->wrapperMapper.begin()->first));
+            // Destroying a wrapper may release others (children).
+            for (const auto &entry : m_d->wrapperMapper.entries()) {
+                if (m_d->wrapperMapper.find(entry.key) == entry.value)
+                    Object::destroy(entry.value, const_cast<void *>(entry.key));
+            }
         }
         assert(m_d->wrapperMapper.empty());
     }
@@ -208,7 +343,7 @@ BindingManager &BindingManager::instance() {
 
 bool BindingManager::hasWrapper(const void *cptr)
 {
-    return m_d->wrapperMapper.find(cptr) != m_d->wrapperMapper.end();
+    return m_d->wrapperMapper.find(cptr) != nullptr;
 }
 
 void BindingManager::registerWrapper(SbkObject *pyObj, void *cptr)
@@ -219,17 +354,23 @@ void BindingManager::registerWrapper(SbkObject *pyObj, void *cptr)
     if (!d)
         return;
 
-    if (d->mi_init && !d->mi_offsets)
-        d->mi_offsets = d->mi_init(cptr);
     m_d->assignWrapper(pyObj, cptr);
-    if (d->mi_offsets) {
-        int *offset = d->mi_offsets;
-        while (*offset != -1) {
-            if (*offset > 0)
-                m_d->assignWrapper(pyObj, reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(cptr) + *offset));
-            offset++;
-        }
-    }
+    m_d->assignOffsetWrappers(d, pyObj, cptr);
+}
+
+SbkObject *BindingManager::findOrRegisterWrapper(SbkObject *pyObj, void *cptr)
+{
+    auto *instanceType = Py_TYPE(pyObj);
+    auto *d = PepType_SOTP(instanceType);
+
+    if (!d)
+        return nullptr;
+
+    assert(cptr);
+    if (SbkObject *existing = m_d->wrapperMapper.findOrInsert(cptr, pyObj))
+        return existing;
+    m_d->assignOffsetWrappers(d, pyObj, cptr);
+    return nullptr;
 }
 
 void BindingManager::releaseWrapper(SbkObject *sbkObj)
@@ -254,29 +395,154 @@ void BindingManager::releaseWrapper(SbkObject *sbkObj)
     sbkObj->d->validCppObject = false;
 }
 
-void BindingManager::runDeletionInMainThread()
+// Runs a batch of destructors under a single release of the GIL. The
+// entries are moved out of the queue first since the destructors may
+// deallocate further wrappers.
+static void runDestructors(std::vector<DestructorEntry> *queue)
 {
-    for (const DestructorEntry &e : m_d->deleteInMainThread)
+    std::vector<DestructorEntry> entries;
+    entries.swap(*queue);
+    ThreadStateSaver threadSaver;
+    if (Py_IsInitialized())
+        threadSaver.save();
+    for (const DestructorEntry &e : entries)
         e.destructor(e.cppInstance);
-    m_d->deleteInMainThread.clear();
+}
+
+static int deletionInMainThreadHandler(void *)
+{
+    if (Py_IsInitialized())
+        BindingManager::instance().runDeletionInMainThread();
+    return 0;
+}
+
+void BindingManager::runDeletionInMainThread()
+{
+    m_d->deletionInMainThreadScheduled = false;
+    if (m_d->deleteInMainThread.empty())
+        return;
+    m_d->destructionStatistics.mainThreadObjects += m_d->deleteInMainThread.size();
+    ++m_d->destructionStatistics.mainThreadBatches;
+    runDestructors(&m_d->deleteInMainThread);
 }
 
 void BindingManager::addToDeletionInMainThread(const DestructorEntry &e)
 {
     m_d->deleteInMainThread.push_back(e);
+    // Schedule one pending call per batch; the queue of pending calls is short.
+    if (!m_d->deletionInMainThreadScheduled) {
+        m_d->deletionInMainThreadScheduled =
+            Py_AddPendingCall(deletionInMainThreadHandler, nullptr) == 0;
+    }
+}
+
+int BindingManager::deferredDestructionHandler(void *)
+{
+    if (Py_IsInitialized()) {
+        auto &bindingManager = BindingManager::instance();
+        bindingManager.m_d->deferredDestructionScheduled = false;
+        bindingManager.runDeferredDestruction();
+    }
+    return 0;
+}
+
+// Registered with atexit to destroy the queued objects and to stop deferring
+// while the interpreter is still fully functional.
+static PyObject *deferredDestructionAtExit(PyObject *, PyObject *)
+{
+    BindingManager::instance().setDestructionBatchThreshold(0);
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef deferredDestructionAtExitMethod = {
+    "_deferredDestructionAtExit", deferredDestructionAtExit, METH_NOARGS, nullptr
+};
+
+static bool registerDeferredDestructionAtExit()
+{
+    AutoDecRef atexit(PyImport_ImportModule("atexit"));
+    AutoDecRef func(PyCFunction_New(&deferredDestructionAtExitMethod, nullptr));
+    if (atexit.isNull() || func.isNull()) {
+        PyErr_Clear();
+        return false;
+    }
+    AutoDecRef result(PyObject_CallMethod(atexit, "register", "O", func.object()));
+    if (result.isNull()) {
+        PyErr_Clear();
+        return false;
+    }
+    return true;
+}
+
+void BindingManager::setDestructionBatchThreshold(int threshold)
+{
+    static bool atExitRegistered = false;
+    if (threshold > 0 && !atExitRegistered) {
+        atExitRegistered = registerDeferredDestructionAtExit();
+        if (!atExitRegistered) // Do not defer past finalization
+            threshold = 0;
+    }
+    m_d->destructionBatchThreshold = std::max(threshold, 0);
+    if (m_d->destructionBatchThreshold == 0)
+        runDeferredDestruction();
+}
+
+int BindingManager::destructionBatchThreshold() const
+{
+    return m_d->destructionBatchThreshold;
+}
+
+bool BindingManager::isDestructionDeferred() const
+{
+    // The pending call runs in the main thread; objects of other threads
+    // need to be destroyed in their thread.
+    return m_d->destructionBatchThreshold > 0 && currentThreadId() == mainThreadId();
+}
+
+void BindingManager::deferDestruction(const DestructorEntry &e)
+{
+    auto &queue = m_d->deferredDestruction;
+    queue.push_back(e);
+    if (queue.size() >= std::size_t(m_d->destructionBatchThreshold)) {
+        runDeferredDestruction();
+    } else if (!m_d->deferredDestructionScheduled) {
+        m_d->deferredDestructionScheduled =
+            Py_AddPendingCall(deferredDestructionHandler, nullptr) == 0;
+        if (!m_d->deferredDestructionScheduled) // Do not keep objects alive indefinitely
+            runDeferredDestruction();
+    }
+}
+
+void BindingManager::runDeferredDestruction()
+{
+    if (m_d->deferredDestruction.empty())
+        return;
+    m_d->destructionStatistics.deferredObjects += m_d->deferredDestruction.size();
+    ++m_d->destructionStatistics.deferredBatches;
+    runDestructors(&m_d->deferredDestruction);
+}
+
+BindingManager::DestructionStatistics BindingManager::destructionStatistics() const
+{
+    return m_d->destructionStatistics;
 }
 
 SbkObject *BindingManager::retrieveWrapper(const void *cptr)
 {
-    auto iter = m_d->wrapperMapper.find(cptr);
-    if (iter == m_d->wrapperMapper.end())
-        return nullptr;
-    return iter->second;
+    return m_d->wrapperMapper.find(cptr);
 }
 
 PyObject *BindingManager::getOverride(const void *cptr,
                                       PyObject *nameCache[],
                                       const char *methodName)
+{
+    return getOverride(cptr, nameCache, methodName, nullptr);
+}
+
+PyObject *BindingManager::getOverride(const void *cptr,
+                                      PyObject *nameCache[],
+                                      const char *methodName,
+                                      bool *cacheFlag)
 {
     SbkObject *wrapper = retrieveWrapper(cptr);
     // The refcount can be 0 if the object is dieing and someone called
@@ -364,6 +630,12 @@ PyObject *BindingManager::getOverride(const void *cptr,
         Py_DECREF(method);
     }
 
+    // Setting attributes of bases not created by Shiboken cannot be detected
+    // to clear the flag.
+    if (cacheFlag != nullptr && PyErr_Occurred() == nullptr
+        && Shiboken::ObjectType::canCacheOverrides(Py_TYPE(wrapper))) {
+        *cacheFlag = true;
+    }
     return nullptr;
 }
 
@@ -381,20 +653,18 @@ PyTypeObject *BindingManager::resolveType(void **cptr, PyTypeObject *type)
 std::set<PyObject *> BindingManager::getAllPyObjects()
 {
     std::set<PyObject *> pyObjects;
-    const WrapperMap &wrappersMap = m_d->wrapperMapper;
-    auto it = wrappersMap.begin();
-    for (; it != wrappersMap.end(); ++it)
-        pyObjects.insert(reinterpret_cast<PyObject *>(it->second));
+    for (const auto &entry : m_d->wrapperMapper.entries())
+        pyObjects.insert(reinterpret_cast<PyObject *>(entry.value));
 
     return pyObjects;
 }
 
 void BindingManager::visitAllPyObjects(ObjectVisitor visitor, void *data)
 {
-    WrapperMap copy = m_d->wrapperMapper;
-    for (auto it = copy.begin(); it != copy.end(); ++it) {
-        if (hasWrapper(it->first))
-            visitor(it->second, data);
+    const auto entries = m_d->wrapperMapper.entries();
+    for (const auto &entry : entries) {
+        if (hasWrapper(entry.key))
+            visitor(entry.value, data);
     }
 }
 
@@ -66,13 +66,54 @@ public:
     bool hasWrapper(const void *cptr);
 
     void registerWrapper(SbkObject *pyObj, void *cptr);
+    /**
+     * Registers \p pyObj as wrapper of \p cptr unless there already is a wrapper
+     * for it, using a single lookup.
+     * \returns the wrapper already registered for \p cptr or nullptr if \p pyObj
+     *          was registered.
+     */
+    SbkObject *findOrRegisterWrapper(SbkObject *pyObj, void *cptr);
     void releaseWrapper(SbkObject *wrapper);
 
     void runDeletionInMainThread();
     void addToDeletionInMainThread(const DestructorEntry &);
 
+    /**
+     * Sets the threshold for deferred destruction. When it is greater than 0,
+     * the C++ objects of wrappers deallocated in the main thread are queued
+     * and destroyed in batches under a single release of the GIL. A batch runs
+     * when the queue reaches \p threshold entries or from a pending call once
+     * the interpreter resumes executing Python code. 0 (default) disables it.
+     */
+    void setDestructionBatchThreshold(int threshold);
+    int destructionBatchThreshold() const;
+    /// Returns whether the C++ objects of wrappers being deallocated are to be
+    /// passed to deferDestruction().
+    bool isDestructionDeferred() const;
+    void deferDestruction(const DestructorEntry &);
+    /// Destroys the C++ objects queued by deferDestruction().
+    void runDeferredDestruction();
+
+    struct DestructionStatistics
+    {
+        /// Objects destroyed by runDeferredDestruction() and number of batches.
+        unsigned long long deferredObjects = 0;
+        unsigned long long deferredBatches = 0;
+        /// Objects destroyed by runDeletionInMainThread() and number of batches.
+        unsigned long long mainThreadObjects = 0;
+        unsigned long long mainThreadBatches = 0;
+    };
+    DestructionStatistics destructionStatistics() const;
+
     SbkObject *retrieveWrapper(const void *cptr);
     PyObject *getOverride(const void *cptr, PyObject *nameCache[], const char *methodName);
+    /**
+     * Returns the Python override of a virtual method like the above. When there is
+     * none and the absence can be cached, \p cacheFlag is set to true.
+     * \see Shiboken::ObjectType::acquireOverrideCache()
+     */
+    PyObject *getOverride(const void *cptr, PyObject *nameCache[], const char *methodName,
+                          bool *cacheFlag);
 
     void addClassInheritance(PyTypeObject *parent, PyTypeObject *child);
     /**
@@ -96,6 +137,8 @@ public:
     void visitAllPyObjects(ObjectVisitor visitor, void *data);
 
 private:
+    static int deferredDestructionHandler(void *);
+
     ~BindingManager();
     BindingManager();
 
@@ -63,11 +63,9 @@ static int testPointerBeingFreed(void *ptr)
 {
     // It is an error for a deleted pointer address to still be registered
     // in the BindingManager
-    if (Shiboken::BindingManager::instance().hasWrapper(ptr)) {
+    if (SbkObject *wrapper = Shiboken::BindingManager::instance().retrieveWrapper(ptr)) {
         Shiboken::GilState state;
 
-        SbkObject *wrapper = Shiboken::BindingManager::instance().retrieveWrapper(ptr);
-
         fprintf(stderr, "SbkObject still in binding map when deleted: ");
         PyObject_Print(reinterpret_cast<PyObject *>(wrapper), stderr, 0);
         fprintf(stderr, "\n");
@@ -349,6 +349,48 @@ int *sequenceToIntArray(PyObject *obj, bool zeroTerminated)
     return array;
 }
 
+bool unpackFastcallArguments(PyObject *const *args, Py_ssize_t nargs, const char *funcName,
+                             Py_ssize_t minArgs, Py_ssize_t maxArgs, PyObject **out)
+{
+    if (nargs < minArgs || nargs > maxArgs) {
+        const bool tooFew = nargs < minArgs;
+        const Py_ssize_t expected = tooFew ? minArgs : maxArgs;
+        const char *qualifier = minArgs == maxArgs ? "" : (tooFew ? "at least " : "at most ");
+        PyErr_Format(PyExc_TypeError, "%s expected %s%zd argument%s, got %zd",
+                     funcName, qualifier, expected, expected == 1 ? "" : "s", nargs);
+        return false;
+    }
+    for (Py_ssize_t i = 0; i < nargs; ++i)
+        out[i] = args[i];
+    return true;
+}
+
+PyObject *fastcallKeywordsToDict(PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    const Py_ssize_t size = kwnames != nullptr ? PyTuple_Size(kwnames) : 0;
+    if (size <= 0)
+        return nullptr;
+    PyObject *result = PyDict_New();
+    if (result == nullptr)
+        return nullptr;
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        if (PyDict_SetItem(result, PyTuple_GetItem(kwnames, i), args[nargs + i]) != 0) {
+            Py_DECREF(result);
+            return nullptr;
+        }
+    }
+    return result;
+}
+
+PyObject *fastcallArgumentsToTuple(PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *result = PyTuple_New(nargs);
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
+        Py_INCREF(args[i]);
+        PyTuple_SetItem(result, i, args[i]);
+    }
+    return result;
+}
 
 int warning(PyObject *category, int stacklevel, const char *format, ...)
 {
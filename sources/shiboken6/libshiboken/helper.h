@@ -93,6 +93,36 @@ class AutoArrayPointer
         T *data;
 };
 
+/**
+ * Unpacks the positional arguments of a METH_FASTCALL call into \p out,
+ * raising a TypeError like PyArg_UnpackTuple() does for an invalid count.
+ *
+ * \returns True on success, false otherwise.
+ */
+LIBSHIBOKEN_API bool unpackFastcallArguments(PyObject *const *args, Py_ssize_t nargs,
+                                             const char *funcName,
+                                             Py_ssize_t minArgs, Py_ssize_t maxArgs,
+                                             PyObject **out);
+
+/**
+ * Creates a keyword argument dictionary from the \p kwnames tuple of a
+ * METH_FASTCALL|METH_KEYWORDS call whose values follow the positional
+ * arguments in \p args.
+ *
+ * \returns A new reference or NULL if no keyword arguments were passed
+ *          or an error occurred (indicated by PyErr_Occurred()).
+ */
+LIBSHIBOKEN_API PyObject *fastcallKeywordsToDict(PyObject *const *args, Py_ssize_t nargs,
+                                                 PyObject *kwnames);
+
+/**
+ * Creates a tuple of the positional arguments of a METH_FASTCALL call,
+ * used for error messages.
+ *
+ * \returns A new reference.
+ */
+LIBSHIBOKEN_API PyObject *fastcallArgumentsToTuple(PyObject *const *args, Py_ssize_t nargs);
+
 using ThreadId = unsigned long long;
 LIBSHIBOKEN_API ThreadId currentThreadId();
 LIBSHIBOKEN_API ThreadId mainThreadId();
@@ -884,6 +884,7 @@ _Pep_PrivateMangle(PyObject *self, PyObject *name)
  *
  */
 
+int PepRuntime_37_flag = 0;
 int PepRuntime_38_flag = 0;
 
 static void
@@ -893,7 +894,10 @@ init_PepRuntime()
     const char *version = Py_GetVersion();
     if (version[0] < '3')
         return;
-    if (std::atoi(version + 2) >= 8)
+    const int minor = std::atoi(version + 2);
+    if (minor >= 7)
+        PepRuntime_37_flag = 1;
+    if (minor >= 8)
         PepRuntime_38_flag = 1;
 }
 
@@ -575,6 +575,21 @@ LIBSHIBOKEN_API PyTypeObject *PepType_Type_tp_new(PyTypeObject *metatype,
 
 extern LIBSHIBOKEN_API int PepRuntime_38_flag;
 
+/*****************************************************************************
+ *
+ * Runtime support for METH_FASTCALL
+ *
+ * METH_FASTCALL is only part of the limited API as of Python 3.10, but the
+ * calling convention has been stable since Python 3.7. Modules using it
+ * must check PepRuntime_37_flag when they are imported.
+ */
+
+#ifndef METH_FASTCALL
+#  define METH_FASTCALL 0x0080
+#endif
+
+extern LIBSHIBOKEN_API int PepRuntime_37_flag;
+
 /*****************************************************************************
  *
  * Module Initialization
@@ -49,4 +49,37 @@ bool isOpaqueContainer(PyObject *o)
                            Shiboken::PyMagicName::opaque_container()) == 1;
 
 }
+
+// Return the kind of a single item struct module format: 'i' (signed),
+// 'u' (unsigned), 'f' (floating point), '?' (bool) or 0 if unsupported.
+static char bufferFormatKind(const char *format)
+{
+    if (format == nullptr) // PyBUF_FORMAT not honored: unsigned bytes
+        return 'u';
+    if (*format == '@' || *format == '=')
+        ++format;
+    if (format[0] == '\0' || format[1] != '\0')
+        return 0;
+    switch (format[0]) {
+    case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+        return 'i';
+    case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+        return 'u';
+    case 'e': case 'f': case 'd':
+        return 'f';
+    case '?':
+        return '?';
+    default:
+        break;
+    }
+    return 0;
+}
+
+bool isCompatibleBufferFormat(const char *format, Py_ssize_t itemSize,
+                              const char *expectedFormat, Py_ssize_t expectedItemSize)
+{
+    const char kind = bufferFormatKind(format);
+    return kind != 0 && kind == bufferFormatKind(expectedFormat)
+        && itemSize == expectedItemSize;
+}
 } // Shiboken
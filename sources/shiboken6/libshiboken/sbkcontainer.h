@@ -41,11 +41,16 @@
 #define SBK_CONTAINER_H
 
 #include "sbkpython.h"
+#include "autodecref.h"
 #include "shibokenmacros.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 extern "C"
 {
@@ -67,18 +72,96 @@ struct ShibokenContainerValueConverter
     static std::optional<Value> convertValueToCpp(PyObject pyArg);
 };
 
+namespace Shiboken
+{
+LIBSHIBOKEN_API bool isOpaqueContainer(PyObject *o);
+
+/// Returns whether a buffer of the struct module \p format and \p itemSize
+/// can be copied into storage of \p expectedFormat and \p expectedItemSize.
+LIBSHIBOKEN_API bool isCompatibleBufferFormat(const char *format, Py_ssize_t itemSize,
+                                              const char *expectedFormat,
+                                              Py_ssize_t expectedItemSize);
+
+/// Returns the struct module format of an arithmetic type or nullptr.
+template <class T>
+constexpr const char *arithmeticBufferFormat()
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        return "?";
+    } else if constexpr (std::is_floating_point_v<T>) {
+        if constexpr (sizeof(T) == sizeof(float))
+            return "f";
+        else if constexpr (sizeof(T) == sizeof(double))
+            return "d";
+        else
+            return nullptr;
+    } else if constexpr (sizeof(T) == sizeof(char)) {
+        return std::is_signed_v<T> ? "b" : "B";
+    } else if constexpr (sizeof(T) == sizeof(short)) {
+        return std::is_signed_v<T> ? "h" : "H";
+    } else if constexpr (sizeof(T) == sizeof(int)) {
+        return std::is_signed_v<T> ? "i" : "I";
+    } else if constexpr (sizeof(T) == sizeof(long)) {
+        return std::is_signed_v<T> ? "l" : "L";
+    } else if constexpr (sizeof(T) == sizeof(long long)) {
+        return std::is_signed_v<T> ? "q" : "Q";
+    } else {
+        return nullptr;
+    }
+}
+} // namespace Shiboken
+
+// Buffer protocol helper traits for container values. Values consisting of a
+// fixed number of arithmetic components (QPointF, for example) can be exposed
+// by specializing it with the format of a component and the component count.
+template <class Value, class Enable = void>
+struct ShibokenContainerValueBufferFormat
+{
+    static constexpr const char *format = nullptr;
+    static constexpr Py_ssize_t componentCount = 0;
+};
+
+template <class Value>
+struct ShibokenContainerValueBufferFormat<Value, std::enable_if_t<std::is_arithmetic_v<Value>>>
+{
+    static constexpr const char *format = Shiboken::arithmeticBufferFormat<Value>();
+    static constexpr Py_ssize_t componentCount = 1;
+};
+
+// Containers storing their values contiguously (QList, std::vector).
+template <class Container, class Enable = void>
+struct ShibokenContainerHasContiguousStorage : std::false_type {};
+
+template <class Container>
+struct ShibokenContainerHasContiguousStorage<Container,
+    std::void_t<decltype(std::declval<Container &>().data())>>
+    : std::is_pointer<decltype(std::declval<Container &>().data())> {};
+
 template <class SequenceContainer>
 class ShibokenSequenceContainerPrivate // Helper for sequence type containers
 {
 public:
     using value_type = typename SequenceContainer::value_type;
     using OptionalValue = typename std::optional<value_type>;
+    using ValueConverter = ShibokenContainerValueConverter<value_type>;
+    using ValueBufferFormat = ShibokenContainerValueBufferFormat<value_type>;
+
+    // Whether the storage can be exposed to the buffer protocol
+    static constexpr bool hasBufferSupport =
+        ShibokenContainerHasContiguousStorage<SequenceContainer>::value
+        && std::is_trivially_copyable_v<value_type>
+        && ValueBufferFormat::format != nullptr && ValueBufferFormat::componentCount > 0;
 
     SequenceContainer *m_list{};
     bool m_ownsList = false;
     bool m_const = false;
+    int m_exports = 0; // Buffer views on the storage, which prevent resizing
+    Py_ssize_t m_bufferShape[2] = {0, 0};
+    Py_ssize_t m_bufferStrides[2] = {0, 0};
     static constexpr const char *msgModifyConstContainer =
         "Attempt to modify a constant container.";
+    static constexpr const char *msgResizeExportedContainer =
+        "Existing exports of data: container cannot be resized.";
 
     static PyObject *tpNew(PyTypeObject *subtype, PyObject * /* args */, PyObject * /* kwds */)
     {
@@ -129,6 +212,18 @@ public:
             PyErr_SetString(PyExc_IndexError, "index out of bounds");
             return -1;
         }
+        if (d->m_const) {
+            PyErr_SetString(PyExc_TypeError, msgModifyConstContainer);
+            return -1;
+        }
+        if (pyArg == nullptr) {
+            if (!checkResizable(d))
+                return -1;
+            auto it = d->m_list->begin();
+            std::advance(it, i);
+            d->m_list->erase(it);
+            return 0;
+        }
         auto it = d->m_list->begin();
         std::advance(it, i);
         OptionalValue value = ShibokenContainerValueConverter<value_type>::convertValueToCpp(pyArg);
@@ -138,6 +233,118 @@ public:
         return 0;
     }
 
+    static PyObject *mpSubscript(PyObject *self, PyObject *key)
+    {
+        auto *d = get(self);
+        const Py_ssize_t size = d->m_list->size();
+        if (PyIndex_Check(key)) {
+            Py_ssize_t i = PyNumber_AsSsize_t(key, PyExc_IndexError);
+            if (i == -1 && PyErr_Occurred() != nullptr)
+                return nullptr;
+            return sqGetItem(self, i < 0 ? i + size : i);
+        }
+
+        Py_ssize_t start, stop, step;
+        if (!unpackSlice(key, &start, &stop, &step))
+            return nullptr;
+        const Py_ssize_t count = PySlice_AdjustIndices(size, &start, &stop, step);
+        PyObject *result = tpNew(Py_TYPE(self), nullptr, nullptr);
+        if (result == nullptr || count == 0)
+            return result;
+        auto *list = get(result)->m_list;
+        auto it = d->m_list->cbegin();
+        std::advance(it, start);
+        if (step == 1) {
+            auto last = it;
+            std::advance(last, count);
+            list->insert(list->end(), it, last);
+            return result;
+        }
+        for (Py_ssize_t i = 0; ; ) {
+            list->push_back(*it);
+            if (++i == count)
+                break;
+            std::advance(it, step);
+        }
+        return result;
+    }
+
+    static int mpAssSubscript(PyObject *self, PyObject *key, PyObject *pyArg)
+    {
+        auto *d = get(self);
+        const Py_ssize_t size = d->m_list->size();
+        if (PyIndex_Check(key)) {
+            Py_ssize_t i = PyNumber_AsSsize_t(key, PyExc_IndexError);
+            if (i == -1 && PyErr_Occurred() != nullptr)
+                return -1;
+            return sqSetItem(self, i < 0 ? i + size : i, pyArg);
+        }
+
+        Py_ssize_t start, stop, step;
+        if (!unpackSlice(key, &start, &stop, &step))
+            return -1;
+        if (d->m_const) {
+            PyErr_SetString(PyExc_TypeError, msgModifyConstContainer);
+            return -1;
+        }
+        const Py_ssize_t count = PySlice_AdjustIndices(size, &start, &stop, step);
+        const bool isExtendedSlice = step != 1;
+        const bool reversed = step < 0;
+        if (reversed && count > 0) { // Normalize to an ascending range, reversing the values
+            start += (count - 1) * step;
+            step = -step;
+        }
+
+        std::vector<value_type> values;
+        if (pyArg != nullptr) {
+            if (pyArg == self)
+                values.assign(d->m_list->cbegin(), d->m_list->cend());
+            else if (!convertValues(pyArg, &values))
+                return -1;
+            if (reversed)
+                std::reverse(values.begin(), values.end());
+        }
+        const Py_ssize_t newCount = values.size();
+
+        auto first = d->m_list->begin();
+        std::advance(first, start);
+        if (step == 1 && newCount == count) {
+            std::copy(values.cbegin(), values.cend(), first);
+            return 0;
+        }
+        if (isExtendedSlice && pyArg != nullptr && newCount != count) {
+            PyErr_Format(PyExc_ValueError,
+                         "attempt to assign sequence of size %zd to extended slice of size %zd",
+                         newCount, count);
+            return -1;
+        }
+        if (step == 1) { // Replace or delete a range, resizing the container
+            if (!checkResizable(d))
+                return -1;
+            auto last = first;
+            std::advance(last, count);
+            auto pos = d->m_list->erase(first, last);
+            d->m_list->insert(pos, values.cbegin(), values.cend());
+            return 0;
+        }
+        if (pyArg == nullptr) { // Delete an extended slice starting from the back
+            if (!checkResizable(d))
+                return -1;
+            for (Py_ssize_t i = count - 1; i >= 0; --i) {
+                auto it = d->m_list->begin();
+                std::advance(it, start + i * step);
+                d->m_list->erase(it);
+            }
+            return 0;
+        }
+        for (Py_ssize_t i = 0; i < count; ++i) {
+            *first = values[i];
+            if (i + 1 < count)
+                std::advance(first, step);
+        }
+        return 0;
+    }
+
     static PyObject *push_back(PyObject *self, PyObject *pyArg)
     {
         auto *d = get(self);
@@ -149,6 +356,8 @@ public:
             PyErr_SetString(PyExc_TypeError, msgModifyConstContainer);
             return nullptr;
         }
+        if (!checkResizable(d))
+            return nullptr;
 
         OptionalValue value = ShibokenContainerValueConverter<value_type>::convertValueToCpp(pyArg);
         if (!value.has_value())
@@ -168,6 +377,8 @@ public:
             PyErr_SetString(PyExc_TypeError, msgModifyConstContainer);
             return nullptr;
         }
+        if (!checkResizable(d))
+            return nullptr;
 
         OptionalValue value = ShibokenContainerValueConverter<value_type>::convertValueToCpp(pyArg);
         if (!value.has_value())
@@ -183,6 +394,8 @@ public:
             PyErr_SetString(PyExc_TypeError, msgModifyConstContainer);
             return nullptr;
         }
+        if (!checkResizable(d))
+            return nullptr;
 
         d->m_list->clear();
         Py_RETURN_NONE;
@@ -195,6 +408,8 @@ public:
             PyErr_SetString(PyExc_TypeError, msgModifyConstContainer);
             return nullptr;
         }
+        if (!checkResizable(d))
+            return nullptr;
 
         d->m_list->pop_back();
         Py_RETURN_NONE;
@@ -207,21 +422,223 @@ public:
             PyErr_SetString(PyExc_TypeError, msgModifyConstContainer);
             return nullptr;
         }
+        if (!checkResizable(d))
+            return nullptr;
 
         d->m_list->pop_front();
         Py_RETURN_NONE;
     }
 
+    // Append the values of an iterable or of a buffer of matching format
+    static PyObject *extend(PyObject *self, PyObject *pyArg)
+    {
+        auto *d = get(self);
+        if (d->m_const) {
+            PyErr_SetString(PyExc_TypeError, msgModifyConstContainer);
+            return nullptr;
+        }
+        if (!checkResizable(d))
+            return nullptr;
+
+        if (pyArg == self) {
+            const SequenceContainer copy = *d->m_list;
+            d->m_list->insert(d->m_list->end(), copy.cbegin(), copy.cend());
+            Py_RETURN_NONE;
+        }
+        if constexpr (hasBufferSupport) {
+            const int copied = copyFromBuffer(pyArg, d->m_list, d->m_list->size());
+            if (copied < 0)
+                return nullptr;
+            if (copied > 0)
+                Py_RETURN_NONE;
+        }
+        std::vector<value_type> values;
+        if (!convertValues(pyArg, &values))
+            return nullptr;
+        d->m_list->insert(d->m_list->end(), values.cbegin(), values.cend());
+        Py_RETURN_NONE;
+    }
+
+    // Replace the contents by the values of an iterable or of a buffer
+    static PyObject *assign(PyObject *self, PyObject *pyArg)
+    {
+        auto *d = get(self);
+        if (d->m_const) {
+            PyErr_SetString(PyExc_TypeError, msgModifyConstContainer);
+            return nullptr;
+        }
+        if (!checkResizable(d))
+            return nullptr;
+        if (pyArg == self)
+            Py_RETURN_NONE;
+
+        if constexpr (hasBufferSupport) {
+            const int copied = copyFromBuffer(pyArg, d->m_list, 0);
+            if (copied < 0)
+                return nullptr;
+            if (copied > 0)
+                Py_RETURN_NONE;
+        }
+        std::vector<value_type> values;
+        if (!convertValues(pyArg, &values))
+            return nullptr;
+        *d->m_list = SequenceContainer(values.cbegin(), values.cend());
+        Py_RETURN_NONE;
+    }
+
+    static int bfGetBuffer(PyObject *self, Py_buffer *view, int flags)
+    {
+        view->obj = nullptr;
+        if constexpr (hasBufferSupport) {
+            auto *d = get(self);
+            if ((flags & PyBUF_WRITABLE) != 0 && d->m_const) {
+                PyErr_SetString(PyExc_BufferError, msgModifyConstContainer);
+                return -1;
+            }
+            static value_type emptyStorage{};
+            auto *list = d->m_list;
+            // Do not detach implicitly shared constant containers
+            value_type *data = d->m_const
+                ? const_cast<value_type *>(std::as_const(*list).data()) : list->data();
+            if (data == nullptr)
+                data = &emptyStorage;
+
+            constexpr Py_ssize_t componentCount = ValueBufferFormat::componentCount;
+            constexpr Py_ssize_t componentSize = Py_ssize_t(sizeof(value_type)) / componentCount;
+            const Py_ssize_t size = list->size();
+            d->m_bufferShape[0] = size;
+            d->m_bufferShape[1] = componentCount;
+            d->m_bufferStrides[0] = Py_ssize_t(sizeof(value_type));
+            d->m_bufferStrides[1] = componentSize;
+
+            view->buf = data;
+            view->len = size * Py_ssize_t(sizeof(value_type));
+            view->readonly = d->m_const ? 1 : 0;
+            view->suboffsets = nullptr;
+            view->internal = nullptr;
+            if ((flags & PyBUF_ND) == PyBUF_ND) {
+                view->itemsize = componentSize;
+                view->format = (flags & PyBUF_FORMAT) != 0
+                    ? const_cast<char *>(ValueBufferFormat::format) : nullptr;
+                view->ndim = componentCount == 1 ? 1 : 2;
+                view->shape = d->m_bufferShape;
+                view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES
+                    ? d->m_bufferStrides : nullptr;
+            } else { // PyBUF_SIMPLE: unsigned bytes
+                view->itemsize = 1;
+                view->format = (flags & PyBUF_FORMAT) != 0 ? const_cast<char *>("B") : nullptr;
+                view->ndim = 1;
+                view->shape = nullptr;
+                view->strides = nullptr;
+            }
+            view->obj = self;
+            Py_INCREF(self);
+            ++d->m_exports;
+            return 0;
+        } else {
+            PyErr_SetString(PyExc_BufferError, "The container does not support the buffer protocol.");
+            return -1;
+        }
+    }
+
+    static void bfReleaseBuffer(PyObject *self, Py_buffer * /* view */)
+    {
+        --get(self)->m_exports;
+    }
+
+    // Buffer procedures to be set on the type or nullptr
+    static PyBufferProcs *bufferProcs()
+    {
+        if constexpr (hasBufferSupport) {
+            static PyBufferProcs procs = {bfGetBuffer, bfReleaseBuffer};
+            return &procs;
+        } else {
+            return nullptr;
+        }
+    }
+
     static ShibokenSequenceContainerPrivate *get(PyObject *self)
     {
         auto *data = reinterpret_cast<ShibokenContainer *>(self);
         return reinterpret_cast<ShibokenSequenceContainerPrivate *>(data->d);
     }
-};
 
-namespace Shiboken
-{
-LIBSHIBOKEN_API bool isOpaqueContainer(PyObject *o);
-}
+private:
+    static bool checkResizable(const ShibokenSequenceContainerPrivate *d)
+    {
+        if (d->m_exports > 0) {
+            PyErr_SetString(PyExc_BufferError, msgResizeExportedContainer);
+            return false;
+        }
+        return true;
+    }
+
+    static bool unpackSlice(PyObject *key, Py_ssize_t *start, Py_ssize_t *stop, Py_ssize_t *step)
+    {
+        if (!PySlice_Check(key)) {
+            PyErr_Format(PyExc_TypeError, "container indices must be integers or slices, not %s",
+                         PepType_GetNameStr(Py_TYPE(key)));
+            return false;
+        }
+        return PySlice_Unpack(key, start, stop, step) == 0;
+    }
+
+    // Convert the values of an iterable, failing without partial results
+    static bool convertValues(PyObject *pyArg, std::vector<value_type> *values)
+    {
+        Shiboken::AutoDecRef iterator(PyObject_GetIter(pyArg));
+        if (iterator.isNull())
+            return false;
+        if (PySequence_Check(pyArg)) {
+            const Py_ssize_t size = PySequence_Size(pyArg);
+            if (size > 0)
+                values->reserve(size);
+            else
+                PyErr_Clear();
+        }
+        while (true) {
+            Shiboken::AutoDecRef item(PyIter_Next(iterator.object()));
+            if (item.isNull())
+                break;
+            OptionalValue value = ValueConverter::convertValueToCpp(item.object());
+            if (!value.has_value())
+                return false;
+            values->push_back(value.value());
+        }
+        return PyErr_Occurred() == nullptr;
+    }
+
+    // Copy a C-contiguous buffer of a compatible format into the container
+    // at position \p pos, resizing it. Returns 1 on success, 0 if the object
+    // does not provide a suitable buffer and -1 on error.
+    static int copyFromBuffer(PyObject *pyArg, SequenceContainer *list, size_t pos)
+    {
+        if constexpr (hasBufferSupport) {
+            if (!PyObject_CheckBuffer(pyArg))
+                return 0;
+            Py_buffer view;
+            if (PyObject_GetBuffer(pyArg, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0) {
+                PyErr_Clear();
+                return 0;
+            }
+            constexpr Py_ssize_t componentSize =
+                Py_ssize_t(sizeof(value_type)) / ValueBufferFormat::componentCount;
+            if (!Shiboken::isCompatibleBufferFormat(view.format, view.itemsize,
+                                                    ValueBufferFormat::format, componentSize)
+                || view.len % Py_ssize_t(sizeof(value_type)) != 0) {
+                PyBuffer_Release(&view);
+                return 0;
+            }
+            const size_t count = size_t(view.len) / sizeof(value_type);
+            list->resize(pos + count);
+            if (count > 0)
+                std::memcpy(list->data() + pos, view.buf, size_t(view.len));
+            PyBuffer_Release(&view);
+            return 1;
+        } else {
+            return 0;
+        }
+    }
+};
 
 #endif // SBK_CONTAINER_H
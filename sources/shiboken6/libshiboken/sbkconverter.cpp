@@ -44,6 +44,7 @@
 #include "bindingmanager.h"
 #include "autodecref.h"
 #include "helper.h"
+#include "sbkmodule.h"
 #include "voidptr.h"
 
 #include <string>
@@ -451,6 +452,12 @@ SbkConverter *getConverter(const char *typeName)
     ConvertersMap::const_iterator it = converters.find(typeName);
     if (it != converters.end())
         return it->second;
+    // The type may be pending lazy creation (generator option --lazy-init).
+    if (Module::loadLazyTypeByCppName(typeName)) {
+        it = converters.find(typeName);
+        if (it != converters.end())
+            return it->second;
+    }
     if (Py_VerboseFlag > 0) {
         const std::string message =
             std::string("Can't find type resolver for type '") + typeName + "'.";
@@ -308,6 +308,7 @@ void SbkEnumTypeDealloc(PyObject *pyObj)
 #endif
     if (setp->converter)
         Shiboken::Conversions::deleteConverter(setp->converter);
+    delete setp->valueIndex;
     PepType_SETP_delete(enumType);
 #ifndef Py_LIMITED_API
     Py_TRASHCAN_SAFE_END(pyObj);
@@ -458,20 +459,14 @@ bool check(PyObject *pyObj)
 
 PyObject *getEnumItemFromValue(PyTypeObject *enumType, long itemValue)
 {
-    PyObject *key, *value;
-    Py_ssize_t pos = 0;
-    PyObject *values = PyDict_GetItem(enumType->tp_dict, Shiboken::PyName::values());
-    if (values == nullptr)
+    const auto *valueIndex = PepType_SETP(reinterpret_cast<SbkEnumType *>(enumType))->valueIndex;
+    if (valueIndex == nullptr)
         return nullptr;
-
-    while (PyDict_Next(values, &pos, &key, &value)) {
-        auto *obj = reinterpret_cast<SbkEnumObject *>(value);
-        if (obj->ob_value == itemValue) {
-            Py_INCREF(value);
-            return value;
-        }
-    }
-    return nullptr;
+    auto it = valueIndex->find(itemValue);
+    if (it == valueIndex->end())
+        return nullptr;
+    Py_INCREF(it->second);
+    return it->second;
 }
 
 static PyTypeObject *createEnum(const char *fullName, const char *cppName,
@@ -582,6 +577,12 @@ newItem(PyTypeObject *enumType, long itemValue, const char *itemName)
                 return nullptr;
         }
         PyDict_SetItemString(values, itemName, reinterpret_cast<PyObject *>(enumObj));
+        // Index the value for getEnumItemFromValue(). Aliases map to the
+        // first item of a value.
+        auto *setp = PepType_SETP(reinterpret_cast<SbkEnumType *>(enumType));
+        if (setp->valueIndex == nullptr)
+            setp->valueIndex = new SbkEnumValueIndex;
+        setp->valueIndex->emplace(itemValue, reinterpret_cast<PyObject *>(enumObj));
     }
 
     return reinterpret_cast<PyObject *>(enumObj);
@@ -43,10 +43,17 @@
 #include "sbkpython.h"
 #include "shibokenmacros.h"
 
+#include <unordered_map>
+
+/// Maps the enum values to the items (borrowed references owned by the
+/// "values" dict of the type) for converting values to items.
+using SbkEnumValueIndex = std::unordered_map<long, PyObject *>;
+
 struct SbkEnumTypePrivate
 {
     SbkConverter *converter;
     const char *cppName;
+    SbkEnumValueIndex *valueIndex;
 };
 
 #endif // SKB_PYENUM_P_H
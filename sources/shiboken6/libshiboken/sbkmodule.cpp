@@ -38,8 +38,14 @@
 ****************************************************************************/
 
 #include "sbkmodule.h"
+#include "autodecref.h"
 #include "basewrapper.h"
 #include "bindingmanager.h"
+#include "sbkstring.h"
+
+#include <cstring>
+#include <deque>
+#include <string>
 #include <unordered_map>
 
 /// This hash maps module objects to arrays of Python types.
@@ -52,6 +58,29 @@ using ModuleConvertersMap = std::unordered_map<PyObject *, SbkConverter **>;
 static ModuleTypesMap moduleTypes;
 static ModuleConvertersMap moduleConverters;
 
+/// A top level type registered for lazy creation along with its nested types.
+struct LazyType
+{
+    PyObject *module;
+    std::string name;
+    Shiboken::Module::TypeCreationFunction func;
+    bool pending = true;
+};
+
+/// Maps the Python names of the types pending creation per module.
+using LazyTypeNameMap = std::unordered_map<std::string, LazyType *>;
+using ModuleLazyTypesMap = std::unordered_map<PyObject *, LazyTypeNameMap>;
+/// Maps the indexes into the type arrays to the lazy types creating them.
+using LazyTypeIndexMap = std::unordered_map<int, LazyType *>;
+using TypesLazyTypesMap = std::unordered_map<PyTypeObject **, LazyTypeIndexMap>;
+/// Maps C++ type names to the lazy types registering converters for them.
+using LazyTypeCppNameMap = std::unordered_map<std::string, LazyType *>;
+
+static std::deque<LazyType> lazyTypes;
+static ModuleLazyTypesMap moduleLazyTypes;
+static TypesLazyTypesMap typesLazyTypes;
+static LazyTypeCppNameMap lazyTypeCppNames;
+
 namespace Shiboken
 {
 namespace Module
@@ -104,4 +133,126 @@ SbkConverter **getTypeConverters(PyObject *module)
     return (iter == moduleConverters.end()) ? 0 : iter->second;
 }
 
+static void createLazyType(LazyType *lazyType)
+{
+    if (!lazyType->pending)
+        return;
+    // Clear the flag first since creating the type may request it recursively.
+    lazyType->pending = false;
+    moduleLazyTypes[lazyType->module].erase(lazyType->name);
+
+    // Type creation may be triggered by converter lookups while an exception is set.
+    PyObject *errorType{};
+    PyObject *errorValue{};
+    PyObject *errorTraceback{};
+    PyErr_Fetch(&errorType, &errorValue, &errorTraceback);
+    lazyType->func(lazyType->module);
+    if (PyErr_Occurred()) {
+        PyErr_Print();
+        const std::string message = "can't initialize type " + lazyType->name;
+        Py_FatalError(message.c_str());
+    }
+    PyErr_Restore(errorType, errorValue, errorTraceback);
+}
+
+// Module level __getattr__ (PEP 562) creating pending types on first access.
+static PyObject *lazyModuleGetattr(PyObject *module, PyObject *name)
+{
+    const char *nameStr = Shiboken::String::toCString(name);
+    if (nameStr == nullptr)
+        return nullptr;
+    auto &names = moduleLazyTypes[module];
+    auto it = names.find(nameStr);
+    if (it != names.end()) {
+        createLazyType(it->second);
+        return PyObject_GetAttr(module, name);
+    }
+    // "from module import *" looks up __all__ and falls back to the module
+    // dictionary, which needs to be complete then.
+    if (std::strcmp(nameStr, "__all__") == 0)
+        loadLazyTypes(module);
+    PyErr_Format(PyExc_AttributeError, "module '%s' has no attribute '%s'",
+                 PyModule_GetName(module), nameStr);
+    return nullptr;
+}
+
+// Module level __dir__ listing the pending types along with the attributes.
+static PyObject *lazyModuleDir(PyObject *module, PyObject * /* unused */)
+{
+    PyObject *dict = PyModule_GetDict(module);
+    PyObject *result = PyDict_Keys(dict);
+    if (result == nullptr)
+        return nullptr;
+    for (const auto &nameIt : moduleLazyTypes[module]) {
+        Shiboken::AutoDecRef name(Shiboken::String::fromCString(nameIt.first.c_str()));
+        PyList_Append(result, name);
+    }
+    return result;
+}
+
+static PyMethodDef lazyModuleMethods[] = {
+    {"__getattr__", reinterpret_cast<PyCFunction>(lazyModuleGetattr), METH_O, nullptr},
+    {"__dir__", reinterpret_cast<PyCFunction>(lazyModuleDir), METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+void addLazyType(PyObject *module, PyTypeObject **types, const char *name,
+                 TypeCreationFunction func, const int *indexes,
+                 const char *const *cppNames)
+{
+    auto moduleIt = moduleLazyTypes.find(module);
+    if (moduleIt == moduleLazyTypes.end()) {
+        moduleIt = moduleLazyTypes.insert({module, {}}).first;
+        PyModule_AddFunctions(module, lazyModuleMethods);
+    }
+
+    lazyTypes.push_back({module, name, func});
+    LazyType *lazyType = &lazyTypes.back();
+    moduleIt->second.insert({lazyType->name, lazyType});
+    auto &typeIndexes = typesLazyTypes[types];
+    for (; *indexes >= 0; ++indexes)
+        typeIndexes.insert({*indexes, lazyType});
+    for (; *cppNames != nullptr; ++cppNames)
+        lazyTypeCppNames.insert({*cppNames, lazyType});
+}
+
+PyTypeObject *loadLazyType(PyTypeObject **types, int index)
+{
+    auto typesIt = typesLazyTypes.find(types);
+    if (typesIt == typesLazyTypes.end())
+        return nullptr;
+    auto indexIt = typesIt->second.find(index);
+    if (indexIt == typesIt->second.end())
+        return nullptr;
+    createLazyType(indexIt->second);
+    return types[index];
+}
+
+bool loadLazyTypeByCppName(const char *typeName)
+{
+    if (lazyTypeCppNames.empty())
+        return false;
+    // Strip the decorations of the names the converters are registered under.
+    std::string name = typeName;
+    while (!name.empty() && (name.back() == '*' || name.back() == '&' || name.back() == ' '))
+        name.pop_back();
+    if (name.compare(0, 6, "const ") == 0)
+        name.erase(0, 6);
+    auto it = lazyTypeCppNames.find(name);
+    if (it == lazyTypeCppNames.end() || !it->second->pending)
+        return false;
+    createLazyType(it->second);
+    return true;
+}
+
+void loadLazyTypes(PyObject *module)
+{
+    auto moduleIt = moduleLazyTypes.find(module);
+    if (moduleIt == moduleLazyTypes.end())
+        return;
+    // Creation removes the entries from the map.
+    while (!moduleIt->second.empty())
+        createLazyType(moduleIt->second.begin()->second);
+}
+
 } } // namespace Shiboken::Module
@@ -94,6 +94,53 @@ LIBSHIBOKEN_API void registerTypeConverters(PyObject *module, SbkConverter **con
  */
 LIBSHIBOKEN_API SbkConverter **getTypeConverters(PyObject *module);
 
+/// Function creating a top level type and its nested types on first use.
+using TypeCreationFunction = void (*)(PyObject *module);
+
+/**
+ *  Registers the top level type \p name of \p module for lazy creation
+ *  (generator option --lazy-init). The type is created by calling \p func when
+ *  it is first accessed as a module attribute, requested from the type array
+ *  or looked up by one of its C++ names by the converters.
+ *  \param module      Module where the type is to be created.
+ *  \param types       Array of types of \p module.
+ *  \param name        Python name of the type in \p module.
+ *  \param func        Function creating the type, its nested types and enums.
+ *  \param indexes     Indexes into \p types of all types created by \p func,
+ *                     terminated by -1.
+ *  \param cppNames    C++ type names under which the converters of \p func
+ *                     are registered, terminated by nullptr.
+ */
+LIBSHIBOKEN_API void addLazyType(PyObject *module, PyTypeObject **types, const char *name,
+                                 TypeCreationFunction func, const int *indexes,
+                                 const char *const *cppNames);
+
+/**
+ *  Creates the type at \p index of \p types if it was registered for lazy creation.
+ *  \returns   The type or nullptr if there is none.
+ */
+LIBSHIBOKEN_API PyTypeObject *loadLazyType(PyTypeObject **types, int index);
+
+/**
+ *  Creates the type which registers a converter under the C++ name \p typeName
+ *  if it was registered for lazy creation.
+ *  \returns   Whether a type was created.
+ */
+LIBSHIBOKEN_API bool loadLazyTypeByCppName(const char *typeName);
+
+/// Creates all types of \p module still pending lazy creation.
+LIBSHIBOKEN_API void loadLazyTypes(PyObject *module);
+
+/**
+ *  Retrieves the type at \p index of \p types, creating it on first use
+ *  when it was registered for lazy creation.
+ */
+inline PyTypeObject *get(PyTypeObject **types, int index)
+{
+    PyTypeObject *type = types[index];
+    return type != nullptr ? type : loadLazyType(types, index);
+}
+
 } } // namespace Shiboken::Module
 
 #endif // SBK_MODULE_H
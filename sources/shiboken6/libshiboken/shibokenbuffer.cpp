@@ -81,6 +81,23 @@ void *Shiboken::Buffer::copyData(PyObject *pyObj, Py_ssize_t *sizeIn)
     return result;
 }
 
+Shiboken::Buffer::ScopedView::ScopedView(PyObject *pyObj, Type type)
+{
+    std::memset(&m_view, 0, sizeof(Py_buffer));
+    if (pyObj != nullptr && PyObject_CheckBuffer(pyObj) != 0) {
+        const int flags = type == ReadOnly ? PyBUF_SIMPLE : PyBUF_WRITABLE;
+        m_valid = PyObject_GetBuffer(pyObj, &m_view, flags) == 0;
+        if (!m_valid)
+            PyErr_Clear();
+    }
+}
+
+Shiboken::Buffer::ScopedView::~ScopedView()
+{
+    if (m_valid)
+        PyBuffer_Release(&m_view);
+}
+
 PyObject *Shiboken::Buffer::newObject(void *memory, Py_ssize_t size, Type type)
 {
     if (size == 0)
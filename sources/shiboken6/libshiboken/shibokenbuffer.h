@@ -87,6 +87,36 @@ namespace Buffer
      */
     LIBSHIBOKEN_API void *copyData(PyObject *pyObj, Py_ssize_t *size = nullptr);
 
+    /**
+     * Holds a contiguous buffer export of \p pyObj for its lifetime, which
+     * allows for passing the data to C++ without copying. The export keeps
+     * the object alive and prevents it from being resized (bytearray).
+     * Pass \p type ReadWrite to request a writable buffer.
+     *
+     * If \p pyObj is null or does not provide a suitable buffer, isValid()
+     * returns false and no Python error is set.
+     */
+    class LIBSHIBOKEN_API ScopedView
+    {
+    public:
+        ScopedView(const ScopedView &) = delete;
+        ScopedView(ScopedView &&) = delete;
+        ScopedView &operator=(const ScopedView &) = delete;
+        ScopedView &operator=(ScopedView &&) = delete;
+
+        explicit ScopedView(PyObject *pyObj, Type type = ReadOnly);
+        ~ScopedView();
+
+        bool isValid() const { return m_valid; }
+        const char *constData() const { return static_cast<const char *>(m_view.buf); }
+        char *data() const { return static_cast<char *>(m_view.buf); }
+        Py_ssize_t size() const { return m_view.len; }
+
+    private:
+        Py_buffer m_view;
+        bool m_valid = false;
+    };
+
 } // namespace Buffer
 } // namespace Shiboken
 
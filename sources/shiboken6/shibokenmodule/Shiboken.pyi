@@ -61,12 +61,17 @@ class VoidPtr(object): ...
 def _unpickle_enum(arg__1: object, arg__2: object) -> object: ...
 def createdByPython(arg__1: object) -> bool: ...
 def delete(arg__1: object) -> None: ...
+def destructionBatchThreshold() -> int: ...
+def destructionStatistics() -> object: ...
 def dump(arg__1: object) -> object: ...
 def getAllValidWrappers() -> object: ...
 def getCppPointer(arg__1: object) -> object: ...
 def invalidate(arg__1: object) -> None: ...
 def isValid(arg__1: object) -> bool: ...
 def ownedByPython(arg__1: object) -> bool: ...
+def privateDataPoolStatistics() -> object: ...
+def runDeferredDestruction() -> None: ...
+def setDestructionBatchThreshold(arg__1: int) -> None: ...
 def wrapInstance(arg__1: int, arg__2: type) -> object: ...
 
 
@@ -0,0 +1,35 @@
+# Runs the generator sequentially and with several jobs and checks that the
+# generated files are identical.
+#
+# Parameters: SHIBOKEN (generator executable), PROJECT_FILE, OUTPUT_DIR and
+# optionally EXTRA_FLAGS (list of additional generator options).
+
+foreach(jobs 1 4)
+    set(output_dir "${OUTPUT_DIR}/jobs${jobs}")
+    file(REMOVE_RECURSE "${output_dir}")
+    execute_process(COMMAND "${SHIBOKEN}" "--project-file=${PROJECT_FILE}"
+                            "--output-directory=${output_dir}" "--jobs=${jobs}"
+                            ${EXTRA_FLAGS}
+                    RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Running the generator with --jobs=${jobs} failed: ${result}")
+    endif()
+endforeach()
+
+file(GLOB_RECURSE sequential_files RELATIVE "${OUTPUT_DIR}/jobs1" "${OUTPUT_DIR}/jobs1/*")
+file(GLOB_RECURSE concurrent_files RELATIVE "${OUTPUT_DIR}/jobs4" "${OUTPUT_DIR}/jobs4/*")
+list(SORT sequential_files)
+list(SORT concurrent_files)
+if(NOT sequential_files STREQUAL concurrent_files)
+    message(FATAL_ERROR "The generated files differ:\n${sequential_files}\n${concurrent_files}")
+endif()
+
+foreach(generated_file ${sequential_files})
+    execute_process(COMMAND "${CMAKE_COMMAND}" -E compare_files
+                            "${OUTPUT_DIR}/jobs1/${generated_file}"
+                            "${OUTPUT_DIR}/jobs4/${generated_file}"
+                    RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${generated_file} differs when generated with --jobs=4.")
+    endif()
+endforeach()
@@ -51,6 +51,9 @@ public:
 
     enum ValEnum { One, Other };
     ValEnum oneOrTheOtherEnumValue(ValEnum enumValue) { return enumValue == One ? Other : One; }
+
+    int add(int value, int offset = 0) const { return m_valId + value + offset; }
+    int add(const Val &other, int offset = 0) const { return m_valId + other.m_valId + offset; }
 private:
     int m_valId;
 };
@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2016 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for method wrappers using the METH_FASTCALL calling convention.'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+from minimal import ListUser, Val
+
+
+class FastcallTest(unittest.TestCase):
+
+    def testPositionalArguments(self):
+        lu = ListUser()
+        self.assertEqual(lu.createMinBoolList(True, False), [True, False])
+
+    def testOverloadResolution(self):
+        val = Val(2)
+        self.assertEqual(val.add(3), 5)
+        self.assertEqual(val.add(Val(4)), 6)
+        self.assertEqual(val.add(3, 10), 15)
+        self.assertEqual(val.add(Val(4), 10), 16)
+
+    def testKeywordArguments(self):
+        val = Val(2)
+        self.assertEqual(val.add(3, offset=10), 15)
+        self.assertEqual(val.add(Val(4), offset=10), 16)
+
+    def testUnknownKeywordArgument(self):
+        self.assertRaises(TypeError, Val(2).add, 3, factor=10)
+
+    def testWrongArgumentCount(self):
+        val = Val(2)
+        self.assertRaises(TypeError, val.add)
+        self.assertRaises(TypeError, val.add, 3, 10, 20)
+        lu = ListUser()
+        self.assertRaises(TypeError, lu.createMinBoolList, True)
+        self.assertRaises(TypeError, lu.createMinBoolList, True, False, True)
+        self.assertRaises(TypeError, lu.createMinBoolList, True, mb2=False)
+
+    def testWrongArgumentType(self):
+        with self.assertRaises(TypeError) as cm:
+            Val(2).add('3')
+        self.assertIn('add', str(cm.exception))
+
+    def testArgumentsAreNotRetained(self):
+        val = Val(2)
+        other = Val(4)
+        refCount = sys.getrefcount(other)
+        for _ in range(10):
+            val.add(other, offset=1)
+        self.assertEqual(sys.getrefcount(other), refCount)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,65 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for the creation of types on first use (--lazy-init).'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+import minimal
+
+
+class LazyInitTest(unittest.TestCase):
+
+    def testAttributeAccess(self):
+        self.assertFalse('MinBoolUser' in vars(minimal))
+        self.assertTrue('MinBoolUser' in dir(minimal))
+        user = minimal.MinBoolUser()
+        self.assertTrue('MinBoolUser' in vars(minimal))
+        self.assertEqual(type(user).__name__, 'MinBoolUser')
+
+    def testStarImport(self):
+        namespace = {}
+        exec('from minimal import *', namespace)
+        for name in ('Obj', 'Val', 'ListUser', 'MinBoolUser'):
+            self.assertTrue(name in namespace)
+
+    def testUnknownAttribute(self):
+        self.assertRaises(AttributeError, getattr, minimal, 'DoesNotExist')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -356,6 +356,38 @@ class ListOfIntListConversionTest(unittest.TestCase):
         self.assertEqual(len(const_l), 4)
         self.assertRaises(TypeError, const_l.append, 6)
 
+    def testOpaqueContainerBulkOperations(self):
+        lu = ListUser()
+        lu.m_stdIntList.extend(range(6))
+        self.assertEqual(list(lu.m_stdIntList), [0, 1, 2, 3, 4, 5])
+        self.assertEqual(lu.m_stdIntList[-1], 5)
+
+        # Slices return copies
+        s = lu.m_stdIntList[1:5:2]
+        self.assertEqual(type(s), StdIntList)
+        self.assertEqual(list(s), [1, 3])
+        self.assertEqual(list(lu.m_stdIntList[::-1]), [5, 4, 3, 2, 1, 0])
+
+        lu.m_stdIntList[1:3] = [10, 20, 30]
+        self.assertEqual(list(lu.m_stdIntList), [0, 10, 20, 30, 3, 4, 5])
+        del lu.m_stdIntList[::2]
+        self.assertEqual(list(lu.m_stdIntList), [10, 30, 4])
+        with self.assertRaises(ValueError):
+            lu.m_stdIntList[::2] = [1, 2, 3]
+
+        # Failing conversions do not leave partial results
+        with self.assertRaises(TypeError):
+            lu.m_stdIntList.extend([1, 'a'])
+        self.assertEqual(list(lu.m_stdIntList), [10, 30, 4])
+
+        lu.m_stdIntList.assign([7, 8])
+        self.assertEqual(list(lu.m_stdIntList), [7, 8])
+
+        const_l = lu.getConstIntList()
+        self.assertRaises(TypeError, const_l.extend, [1])
+        with self.assertRaises(TypeError):
+            const_l[0] = 1
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for the buffer protocol of opaque containers.'''
+
+import array
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from minimal import StdIntList, StdIntVector
+
+
+class OpaqueContainerBufferTest(unittest.TestCase):
+
+    def testMemoryView(self):
+        v = StdIntVector()
+        v.extend(range(5))
+        with memoryview(v) as view:
+            self.assertEqual(view.format, 'i')
+            self.assertEqual(view.shape, (5,))
+            self.assertEqual(view.tolist(), [0, 1, 2, 3, 4])
+            view[0] = 42
+            self.assertEqual(v[0], 42)
+            # The storage must not be reallocated while it is exported
+            self.assertRaises(BufferError, v.append, 1)
+            self.assertRaises(BufferError, v.extend, [1])
+        v.append(5)
+        self.assertEqual(len(v), 6)
+
+    def testEmpty(self):
+        with memoryview(StdIntVector()) as view:
+            self.assertEqual(view.tolist(), [])
+
+    def testBulkCopyFromBuffer(self):
+        v = StdIntVector()
+        v.assign(array.array('i', range(1000)))
+        self.assertEqual(len(v), 1000)
+        self.assertEqual(v[999], 999)
+        v.extend(array.array('i', [1, 2]))
+        self.assertEqual(list(v[-3:]), [999, 1, 2])
+        v.extend(v)
+        self.assertEqual(len(v), 2004)
+        # Buffers of a different format are converted element-wise
+        v.assign(array.array('b', [1, 2, 3]))
+        self.assertEqual(list(v), [1, 2, 3])
+
+    def testNonContiguousContainer(self):
+        self.assertRaises(TypeError, memoryview, StdIntList())
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Measures dropping a list of wrappers with and without deferred destruction.
+
+This is not part of the test suite. The number of objects defaults to 10^5
+and can be set by the environment variable SHIBOKEN_DESTRUCTION_OBJECTS.'''
+
+import gc
+import os
+import sys
+import time
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from shiboken6 import Shiboken
+from sample import Point
+
+
+class DeferredDestructionBenchmark(unittest.TestCase):
+
+    def tearDown(self):
+        Shiboken.setDestructionBatchThreshold(0)
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testDropContainer(self):
+        count = int(os.environ.get('SHIBOKEN_DESTRUCTION_OBJECTS', 100000))
+        timings = []
+        for threshold in (0, 1024):
+            Shiboken.setDestructionBatchThreshold(threshold)
+            points = [Point(i, i) for i in range(count)]
+            start = time.perf_counter()
+            del points
+            gc.collect()
+            Shiboken.runDeferredDestruction()
+            timings.append(time.perf_counter() - start)
+        print(f"\nDropping {count} wrappers: {count / timings[0]:.0f}/s, "
+              f"deferred: {count / timings[1]:.0f}/s", file=sys.stderr)
+
+
+if __name__ == '__main__':
+    unittest.main()
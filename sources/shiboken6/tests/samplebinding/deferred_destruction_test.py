@@ -0,0 +1,142 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+
+'''Test cases for the deferred destruction of C++ objects owned by wrappers.'''
+
+import gc
+import os
+import subprocess
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from shiboken6 import Shiboken
+from sample import VirtualDtor
+
+
+class DeferredDestructionTest(unittest.TestCase):
+
+    def setUp(self):
+        VirtualDtor.resetDtorCounter()
+
+    def tearDown(self):
+        Shiboken.setDestructionBatchThreshold(0)
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testBatches(self):
+        Shiboken.setDestructionBatchThreshold(4)
+        self.assertEqual(Shiboken.destructionBatchThreshold(), 4)
+        before = Shiboken.destructionStatistics()
+        objects = [VirtualDtor.create() for i in range(10)]
+        del objects
+        gc.collect()
+        Shiboken.runDeferredDestruction()
+        self.assertEqual(VirtualDtor.dtorCalled(), 10)
+        after = Shiboken.destructionStatistics()
+        self.assertEqual(after['deferredObjects'] - before['deferredObjects'], 10)
+        self.assertEqual(after['deferredBatches'] - before['deferredBatches'], 3)
+
+    def testPythonOverridesAreNotDeferred(self):
+        Shiboken.setDestructionBatchThreshold(1000)
+        obj = VirtualDtor()
+        del obj
+        gc.collect()
+        self.assertEqual(VirtualDtor.dtorCalled(), 1)
+
+    def testDisabling(self):
+        Shiboken.setDestructionBatchThreshold(1000)
+        objects = [VirtualDtor.create() for i in range(10)]
+        del objects
+        gc.collect()
+        # Disabling destroys the queued objects.
+        Shiboken.setDestructionBatchThreshold(0)
+        self.assertEqual(VirtualDtor.dtorCalled(), 10)
+        obj = VirtualDtor.create()
+        del obj
+        gc.collect()
+        self.assertEqual(VirtualDtor.dtorCalled(), 11)
+
+    def testThreshold(self):
+        Shiboken.setDestructionBatchThreshold(-1)
+        self.assertEqual(Shiboken.destructionBatchThreshold(), 0)
+        Shiboken.setDestructionBatchThreshold(5)
+        before = Shiboken.destructionStatistics()
+        # Reaching the threshold runs a batch right away.
+        objects = [VirtualDtor.create() for i in range(5)]
+        del objects
+        self.assertEqual(VirtualDtor.dtorCalled(), 5)
+        after = Shiboken.destructionStatistics()
+        self.assertEqual(after['deferredObjects'] - before['deferredObjects'], 5)
+        self.assertEqual(after['deferredBatches'] - before['deferredBatches'], 1)
+        # Objects below the threshold are destroyed in one further batch.
+        objects = [VirtualDtor.create() for i in range(3)]
+        del objects
+        gc.collect()
+        Shiboken.runDeferredDestruction()
+        self.assertEqual(VirtualDtor.dtorCalled(), 8)
+        after = Shiboken.destructionStatistics()
+        self.assertEqual(after['deferredObjects'] - before['deferredObjects'], 8)
+        self.assertEqual(after['deferredBatches'] - before['deferredBatches'], 2)
+        self.assertEqual(after['mainThreadObjects'], before['mainThreadObjects'])
+        # An empty queue does not count as batch.
+        Shiboken.runDeferredDestruction()
+        self.assertEqual(Shiboken.destructionStatistics(), after)
+
+    def testAtExit(self):
+        '''Deferred destruction ends before the interpreter is finalized.'''
+        tests_dir = os.fspath(Path(__file__).resolve().parents[1])
+        code = f'''
+import atexit
+import sys
+sys.path.append({tests_dir!r})
+from shiboken_paths import init_paths
+init_paths()
+from shiboken6 import Shiboken
+from sample import VirtualDtor
+
+# Runs after the handler registered by setDestructionBatchThreshold()
+atexit.register(lambda: print(Shiboken.destructionBatchThreshold(),
+                              VirtualDtor.dtorCalled()))
+Shiboken.setDestructionBatchThreshold(1000)
+objects = [VirtualDtor.create() for i in range(10)]
+del objects
+'''
+        result = subprocess.run([sys.executable, '-c', code], capture_output=True,
+                                text=True, check=True)
+        self.assertEqual(result.stdout.split(), ['0', '10'])
+
+
+if __name__ == '__main__':
+    unittest.main()
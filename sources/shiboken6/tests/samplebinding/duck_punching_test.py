@@ -164,6 +164,75 @@ class DuckPunchingTest(unittest.TestCase):
 
         monkey.exists = None
 
+    def testMonkeyPatchOnClass(self):
+        '''Injects new 'virtualMethod0' on a class after C++ called the method of its instances.'''
+        class Goose(VirtualMethods):
+            pass
+
+        goose = Goose()
+        pt, val, cpx, b = Point(1.1, 2.2), 4, complex(3.3, 4.4), True
+        result = goose.callVirtualMethod0(pt, val, cpx, b)
+        self.assertEqual(result, VirtualMethods.virtualMethod0(goose, pt, val, cpx, b))
+        self.assertEqual(Goose().callVirtualMethod0(pt, val, cpx, b), result)
+
+        def myVirtualMethod0(obj, pt, val, cpx, b):
+            self.duck_method_called = True
+            return VirtualMethods.virtualMethod0(obj, pt, val, cpx, b) * self.multiplier
+        Goose.virtualMethod0 = myVirtualMethod0
+
+        self.assertEqual(goose.callVirtualMethod0(pt, val, cpx, b), result * self.multiplier)
+        self.assertTrue(self.duck_method_called)
+        self.duck_method_called = False
+        self.assertEqual(Goose().callVirtualMethod0(pt, val, cpx, b), result * self.multiplier)
+        self.assertTrue(self.duck_method_called)
+
+    def testMonkeyPatchOnBaseClass(self):
+        '''Injects new 'virtualMethod0' on a base class after C++ called the method of
+           instances of a derived class.'''
+        class Goose(VirtualMethods):
+            pass
+
+        class Gosling(Goose):
+            pass
+
+        gosling = Gosling()
+        pt, val, cpx, b = Point(1.1, 2.2), 4, complex(3.3, 4.4), True
+        result = gosling.callVirtualMethod0(pt, val, cpx, b)
+        self.assertEqual(result, VirtualMethods.virtualMethod0(gosling, pt, val, cpx, b))
+
+        def myVirtualMethod0(obj, pt, val, cpx, b):
+            self.duck_method_called = True
+            return VirtualMethods.virtualMethod0(obj, pt, val, cpx, b) * self.multiplier
+        Goose.virtualMethod0 = myVirtualMethod0
+
+        self.assertEqual(gosling.callVirtualMethod0(pt, val, cpx, b), result * self.multiplier)
+        self.assertTrue(self.duck_method_called)
+
+    def testMonkeyPatchOnMixin(self):
+        '''Injects new 'virtualMethod0' on a pure Python base class after C++ called the
+           method of instances of a derived class.'''
+        class Mixin:
+            pass
+
+        class Goose(Mixin, VirtualMethods):
+            pass
+
+        goose = Goose()
+        pt, val, cpx, b = Point(1.1, 2.2), 4, complex(3.3, 4.4), True
+        result = goose.callVirtualMethod0(pt, val, cpx, b)
+        self.assertEqual(result, VirtualMethods.virtualMethod0(goose, pt, val, cpx, b))
+
+        def myVirtualMethod0(obj, pt, val, cpx, b):
+            self.duck_method_called = True
+            return VirtualMethods.virtualMethod0(obj, pt, val, cpx, b) * self.multiplier
+        Mixin.virtualMethod0 = myVirtualMethod0
+
+        self.assertEqual(goose.callVirtualMethod0(pt, val, cpx, b), result * self.multiplier)
+        self.assertTrue(self.duck_method_called)
+        self.duck_method_called = False
+        self.assertEqual(Goose().callVirtualMethod0(pt, val, cpx, b), result * self.multiplier)
+        self.assertTrue(self.duck_method_called)
+
     def testForInfiniteRecursion(self):
         def myVirtualMethod0(obj, pt, val, cpx, b):
             self.call_counter += 1
@@ -90,6 +90,13 @@ class EnumTest(unittest.TestCase):
         self.assertTrue(enumout, SampleNamespace.TwoOut)
         self.assertEqual(repr(enumout), repr(SampleNamespace.TwoOut))
 
+    def testBuildingEnumFromValues(self):
+        '''Building an enum from the integer value of each item yields the named item.'''
+        for value_name, item in SampleNamespace.Option.values.items():
+            enum = SampleNamespace.Option(int(item))
+            self.assertEqual(enum, item)
+            self.assertEqual(enum.name, item.name)
+
     def testEnumConstructorWithTooManyParameters(self):
         '''Calling the constructor of non-extensible enum with the wrong number of parameters.'''
         self.assertRaises(TypeError, SampleNamespace.InValue, 13, 14)
@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+
+'''Test cases for the reuse of C++ instances of value types returned by copy
+(typesystem attribute "instance-pool-size" of Size).'''
+
+import gc
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from shiboken6 import Shiboken
+from sample import Size
+
+
+class InstancePoolTest(unittest.TestCase):
+
+    def tearDown(self):
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testReusedInstancesHaveNewValues(self):
+        one = Size(1, 2)
+        size = Size()
+        for i in range(1, 100):
+            size = size + one
+            self.assertEqual(size.width(), i)
+            self.assertEqual(size.height(), 2 * i)
+
+    @unittest.skipUnless(hasattr(sys, "getrefcount"), f"{sys.implementation.name} has no refcount")
+    def testInstanceIsReused(self):
+        one = Size(1, 1)
+        temporary = one * 2
+        address = Shiboken.getCppPointer(temporary)[0]
+        del temporary
+        size = one * 3
+        self.assertEqual(Shiboken.getCppPointer(size)[0], address)
+        self.assertEqual(size.width(), 3)
+        # A wrapper created from Python does not take pooled instances
+        del size
+        created = Size(4, 4)
+        self.assertNotEqual(Shiboken.getCppPointer(created)[0], address)
+        size = one * 5
+        self.assertEqual(Shiboken.getCppPointer(size)[0], address)
+
+    def testLiveInstancesAreNotReused(self):
+        one = Size(1, 1)
+        sizes = []
+        for i in range(32):
+            temporary = one * 100
+            sizes.append(one * i)
+            del temporary
+        for i, size in enumerate(sizes):
+            self.assertEqual(size.width(), i)
+            self.assertEqual(size.height(), i)
+        addresses = set(Shiboken.getCppPointer(s)[0] for s in sizes)
+        self.assertEqual(len(addresses), len(sizes))
+
+    def testOwnershipAndDeletion(self):
+        one = Size(1, 1)
+        for i in range(16):
+            size = one * i
+            self.assertTrue(Shiboken.ownedByPython(size))
+            if i % 2:
+                Shiboken.delete(size)
+                self.assertFalse(Shiboken.isValid(size))
+            del size
+        size = one * 3
+        self.assertEqual(size.calculateArea(), 9)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Measures reparenting many children between parents.
+
+This is not part of the test suite. The number of children defaults to 10^5
+and can be set by the environment variable SHIBOKEN_REPARENTING_CHILDREN.'''
+
+import gc
+import os
+import sys
+import time
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from shiboken6 import Shiboken
+from sample import ObjectType
+
+
+class ReparentingBenchmark(unittest.TestCase):
+
+    def tearDown(self):
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testReparenting(self):
+        count = int(os.environ.get('SHIBOKEN_REPARENTING_CHILDREN', 100000))
+        parent1 = ObjectType()
+        parent2 = ObjectType()
+        children = [ObjectType() for i in range(count)]
+
+        start = time.perf_counter()
+        for child in children:
+            child.setParent(parent1)
+        added = time.perf_counter() - start
+
+        # Children are removed from the front of the C++ list of the parent,
+        # so that the bindings' bookkeeping dominates.
+        start = time.perf_counter()
+        for child in children:
+            child.setParent(parent2)
+        reparented = time.perf_counter() - start
+
+        self.assertTrue(all(c.parent() is parent2 for c in children[::1000]))
+        self.assertFalse(Shiboken.ownedByPython(children[0]))
+
+        start = time.perf_counter()
+        del parent2
+        destroyed = time.perf_counter() - start
+        self.assertFalse(any(Shiboken.isValid(c) for c in children[::1000]))
+
+        print(f"\nReparenting {count} children: add {added * 1000:.1f}ms, "
+              f"reparent {reparented * 1000:.1f}ms, destroy parent {destroyed * 1000:.1f}ms",
+              file=sys.stderr)
+
+
+if __name__ == '__main__':
+    unittest.main()
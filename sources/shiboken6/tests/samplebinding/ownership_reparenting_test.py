@@ -41,6 +41,7 @@ from shiboken_paths import init_paths
 init_paths()
 import sys
 
+from shiboken6 import Shiboken
 from sample import ObjectType
 
 class ExtObjectType(ObjectType):
@@ -132,6 +133,21 @@ class ReparentingTest(unittest.TestCase):
         for child in new_parent.children():
             self.assertTrue(child in object_list)
 
+    def testRemoveFromMiddle(self):
+        '''Remove children from the middle of the children list.'''
+        parent = ObjectType()
+        children = [ObjectType() for i in range(5)]
+        for child in children:
+            child.setParent(parent)
+        children[2].setParent(None)
+        self.assertTrue(Shiboken.ownedByPython(children[2]))
+        self.assertEqual(parent.children(), children[:2] + children[3:])
+        for child in children:
+            child.setParent(None)
+        self.assertEqual(parent.children(), [])
+        del parent
+        self.assertTrue(all(Shiboken.isValid(c) for c in children))
+
 
 if __name__ == '__main__':
     unittest.main()
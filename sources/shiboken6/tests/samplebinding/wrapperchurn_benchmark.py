@@ -0,0 +1,73 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Measures the creation and destruction of wrappers of value types.
+
+This is not part of the test suite. The number of objects defaults to 10^6
+and can be set by the environment variable SHIBOKEN_WRAPPERCHURN_OBJECTS.'''
+
+import gc
+import os
+import sys
+import time
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from shiboken6 import Shiboken
+from sample import Point
+
+
+class WrapperChurnBenchmark(unittest.TestCase):
+
+    def tearDown(self):
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testTemporaries(self):
+        count = int(os.environ.get('SHIBOKEN_WRAPPERCHURN_OBJECTS', 1000000))
+        offset = Point(1, 1)
+        point = Point()
+        start = time.perf_counter()
+        for i in range(count):
+            point = point + offset
+        elapsed = time.perf_counter() - start
+        self.assertEqual(point, Point(count, count))
+        capacity = Shiboken.privateDataPoolStatistics()['capacity']
+        print(f"\nWrapper churn: {count / elapsed:.0f} temporary Point wrappers/s, "
+              f"{capacity} pooled private data blocks", file=sys.stderr)
+
+
+if __name__ == '__main__':
+    unittest.main()
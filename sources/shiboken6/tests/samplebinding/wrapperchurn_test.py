@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for the creation and destruction of wrappers.'''
+
+import gc
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from shiboken6 import Shiboken
+from sample import ObjectType, Point, Str
+
+
+class MultipleCppBases(ObjectType, Str):
+    def __init__(self, name):
+        ObjectType.__init__(self)
+        Str.__init__(self, name)
+
+
+class WrapperChurnTest(unittest.TestCase):
+
+    def tearDown(self):
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+
+    def testPoolReuse(self):
+        '''The private data blocks of destroyed wrappers are reused.'''
+        points = [Point(i, i) for i in range(1000)]
+        stats = Shiboken.privateDataPoolStatistics()
+        self.assertGreaterEqual(stats['capacity'], stats['used'])
+        self.assertGreaterEqual(stats['used'], 1000)
+        del points
+        released = Shiboken.privateDataPoolStatistics()
+        self.assertEqual(released['used'], stats['used'] - 1000)
+        self.assertEqual(released['capacity'], stats['capacity'])
+        # Creating the same number of wrappers again does not grow the pool
+        for i in range(10):
+            points = [Point(i, j) for j in range(1000)]
+            del points
+        self.assertEqual(Shiboken.privateDataPoolStatistics()['capacity'], stats['capacity'])
+
+    def testRecycledWrappers(self):
+        # Wrappers allocated from recycled blocks start out clean.
+        for i in range(1000):
+            points = [Point(i, j) for j in range(10)]
+            self.assertEqual(points[9], Point(i, 9))
+            self.assertTrue(all(Shiboken.ownedByPython(p) for p in points))
+            del points
+            obj = ObjectType()
+            self.assertEqual(len(Shiboken.getCppPointer(obj)), 1)
+            self.assertNotEqual(Shiboken.getCppPointer(obj)[0], 0)
+            self.assertEqual(obj.parent(), None)
+
+    def testMultipleCppBases(self):
+        for i in range(1000):
+            obj = MultipleCppBases(f"name{i}")
+            self.assertEqual(len(Shiboken.getCppPointer(obj)), 2)
+            self.assertEqual(obj, f"name{i}")
+            Shiboken.delete(obj)
+            self.assertFalse(Shiboken.isValid(obj))
+
+
+if __name__ == '__main__':
+    unittest.main()
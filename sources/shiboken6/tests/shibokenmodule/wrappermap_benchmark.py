@@ -0,0 +1,78 @@
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Measures the throughput of the wrapper map of the binding manager.
+
+This is not part of the test suite. The number of objects defaults to 10^6
+and can be set by the environment variable SHIBOKEN_WRAPPERMAP_OBJECTS
+(for example, 10000000).'''
+
+import os
+import sys
+import time
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from shiboken6 import Shiboken
+from sample import ObjectType
+
+
+class WrapperMapTest(unittest.TestCase):
+
+    def testCreateLookupDestroy(self):
+        count = int(os.environ.get('SHIBOKEN_WRAPPERMAP_OBJECTS', 1000000))
+
+        start = time.perf_counter()
+        objects = [ObjectType() for i in range(count)]
+        creation = time.perf_counter() - start
+
+        addresses = [Shiboken.getCppPointer(obj)[0] for obj in objects]
+        start = time.perf_counter()
+        wrapped = [Shiboken.wrapInstance(address, ObjectType) for address in addresses]
+        lookup = time.perf_counter() - start
+        for i in range(0, count, max(1, count // 1000)):
+            self.assertTrue(wrapped[i] is objects[i])
+        del wrapped
+
+        wrappersBefore = len(Shiboken.getAllValidWrappers())
+        start = time.perf_counter()
+        del objects
+        destruction = time.perf_counter() - start
+        self.assertEqual(len(Shiboken.getAllValidWrappers()), wrappersBefore - count)
+
+        print(f"\nWrapper map with {count} objects: creation {count / creation:.0f}/s, "
+              f"lookup {count / lookup:.0f}/s, destruction {count / destruction:.0f}/s",
+              file=sys.stderr)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,77 @@
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for the wrapper map of the binding manager.'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from shiboken6 import Shiboken
+from sample import ObjectType
+
+
+class WrapperMapTest(unittest.TestCase):
+
+    def testLookupWhileGrowing(self):
+        '''Wrappers are found while the map is resized several times.'''
+        objects = []
+        for i in range(5000):
+            objects.append(ObjectType())
+            if i % 997 == 0:
+                for obj in objects:
+                    address = Shiboken.getCppPointer(obj)[0]
+                    self.assertIs(Shiboken.wrapInstance(address, ObjectType), obj)
+
+    def testLookupAfterErase(self):
+        '''Erasing wrappers keeps the remaining ones reachable.'''
+        objects = [ObjectType() for i in range(3000)]
+        wrappersBefore = len(Shiboken.getAllValidWrappers())
+        # Erase in an interleaved pattern to move entries of probe sequences
+        del objects[::3]
+        self.assertEqual(len(Shiboken.getAllValidWrappers()), wrappersBefore - 1000)
+        for obj in objects:
+            address = Shiboken.getCppPointer(obj)[0]
+            self.assertIs(Shiboken.wrapInstance(address, ObjectType), obj)
+        # Refill and check again
+        objects += [ObjectType() for i in range(1000)]
+        self.assertEqual(len(Shiboken.getAllValidWrappers()), wrappersBefore)
+        for obj in objects:
+            address = Shiboken.getCppPointer(obj)[0]
+            self.assertIs(Shiboken.wrapInstance(address, ObjectType), obj)
+        del objects
+        self.assertEqual(len(Shiboken.getAllValidWrappers()), wrappersBefore - 3000)
+
+
+if __name__ == '__main__':
+    unittest.main()